@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""myip_* 레지스터 맵 생성기
+
+IP 폴더의 regmap.json 하나로
+  hdl/<ip>_regs.v                      : 레지스터 파일 (axil_slave_pipe 의 wr_*/rd_* 에 연결)
+  drivers/<ip>_v1_0/src/<ip>_regs.h    : 오프셋 / 비트 정의
+를 만든다. 슬레이브의 user logic 은 생성된 포트만 쓰면 됨.
+
+  python3 common/regmap.py myip_hbridge_1_0          # 생성
+  python3 common/regmap.py --check myip_hbridge_1_0  # 생성 결과가 커밋된 파일과 같은지만 확인
+  python3 common/regmap.py --sync                    # common/hdl/axil_slave_pipe.v 를 모든 IP hdl/ 로 복사
+
+regmap.json 형식
+  {
+    "ip": "myip_hbridge",
+    "addr_width": 6,
+    "regs": [
+      {"name": "ctrl", "offset": 0, "access": "rw", "desc": "...",
+       "fields": [{"name": "enable", "bit": 0}, {"name": "brake", "bit": 1}]},
+      {"name": "applied_l", "offset": 24, "access": "ro", "desc": "..."}
+    ]
+  }
+access
+  rw : 레지스터 (바이트 strobe 반영, 리셋값 "reset", 기본 0) → output reg [31:0] <name>
+  ro : 읽기 전용 입력                                       → input [31:0] <name>
+  rc : 읽기 전용 입력 + 읽는 클럭 펄스 (읽으면 지우는 이벤트) → input <name>, output <name>_rd
+  wp : 쓰기 펄스 (값은 저장 안 함, 데이터는 wr_data)          → output <name>_wr
+"""
+import json
+import os
+import shutil
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ACCESS = ("rw", "ro", "rc", "wp")
+
+
+def load(ip_dir):
+    with open(os.path.join(ip_dir, "regmap.json"), encoding="utf-8") as f:
+        spec = json.load(f)
+    seen = {}
+    for r in spec["regs"]:
+        if r["access"] not in ACCESS:
+            sys.exit("%s: unknown access %s" % (r["name"], r["access"]))
+        if r["offset"] % 4:
+            sys.exit("%s: offset 0x%x not word aligned" % (r["name"], r["offset"]))
+        if r["offset"] >> 2 >= 1 << (spec["addr_width"] - 2):
+            sys.exit("%s: offset 0x%x outside addr_width %d" % (r["name"], r["offset"], spec["addr_width"]))
+        if r["offset"] in seen:
+            sys.exit("%s: offset 0x%x already used by %s" % (r["name"], r["offset"], seen[r["offset"]]))
+        seen[r["offset"]] = r["name"]
+    spec["regs"].sort(key=lambda r: r["offset"])
+    return spec
+
+
+def gen_verilog(spec):
+    ip = spec["ip"]
+    idx_w = spec["addr_width"] - 2
+    regs = spec["regs"]
+    out = []
+    w = out.append
+
+    w("`timescale 1 ns / 1 ps")
+    w("// %s 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)" % ip)
+    for r in regs:
+        w(("// 0x%02X %-10s %s  %s" % (r["offset"], r["name"].upper(), r["access"], r.get("desc", ""))).rstrip())
+    w("")
+    w("module %s_regs #" % ip)
+    w("(")
+    w("\tparameter integer C_S_AXI_DATA_WIDTH\t= 32")
+    w(")")
+    w("(")
+    w("\tinput wire  clk,")
+    w("\tinput wire  resetn,")
+    w("\tinput wire  wr_en,")
+    w("\tinput wire [%d : 0] wr_idx," % (idx_w - 1))
+    w("\tinput wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,")
+    w("\tinput wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,")
+    w("\tinput wire  rd_en,")
+    w("\tinput wire [%d : 0] rd_idx," % (idx_w - 1))
+    ports = []
+    for r in regs:
+        n = r["name"]
+        if r["access"] == "rw":
+            ports.append("\toutput reg [C_S_AXI_DATA_WIDTH-1 : 0] %s" % n)
+        elif r["access"] == "ro":
+            ports.append("\tinput wire [C_S_AXI_DATA_WIDTH-1 : 0] %s" % n)
+        elif r["access"] == "rc":
+            ports.append("\tinput wire [C_S_AXI_DATA_WIDTH-1 : 0] %s" % n)
+            ports.append("\toutput wire  %s_rd" % n)
+        else:
+            ports.append("\toutput wire  %s_wr" % n)
+    ports.append("\toutput reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data")
+    w(",\n".join(ports))
+    w(");")
+    w("")
+    for r in regs:
+        w("\tlocalparam [%d:0] IDX_%s = %d;" % (idx_w - 1, r["name"].upper(), r["offset"] >> 2))
+    w("")
+    w("\tinteger\t byte_index;")
+    w("")
+
+    rw = [r for r in regs if r["access"] == "rw"]
+    if rw:
+        w("\talways @( posedge clk )")
+        w("\tbegin")
+        w("\t  if ( resetn == 1'b0 )")
+        w("\t    begin")
+        for r in rw:
+            w("\t      %s <= %s;" % (r["name"], r.get("reset", 0)))
+        w("\t    end")
+        w("\t  else if ( wr_en )")
+        w("\t    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )")
+        w("\t      if ( wr_strb[byte_index] == 1 )")
+        w("\t        case ( wr_idx )")
+        for r in rw:
+            w("\t          IDX_%s: %s[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];" % (r["name"].upper(), r["name"]))
+        w("\t          default: ;")
+        w("\t        endcase")
+        w("\tend")
+        w("")
+
+    pulses = [r for r in regs if r["access"] in ("wp", "rc")]
+    for r in pulses:
+        if r["access"] == "wp":
+            w("\tassign %s_wr = wr_en && (wr_idx == IDX_%s);" % (r["name"], r["name"].upper()))
+        else:
+            w("\tassign %s_rd = rd_en && (rd_idx == IDX_%s);" % (r["name"], r["name"].upper()))
+    if pulses:
+        w("")
+    w("\talways @(*) begin")
+    w("\t  case ( rd_idx )")
+    for r in regs:
+        if r["access"] != "wp":
+            w("\t    IDX_%s: rd_data = %s;" % (r["name"].upper(), r["name"]))
+    w("\t    default: rd_data = 0;")
+    w("\t  endcase")
+    w("\tend")
+    w("")
+    w("endmodule")
+    return "\n".join(out) + "\n"
+
+
+def gen_header(spec):
+    ip = spec["ip"].upper()
+    guard = "%s_REGS_H" % ip
+    out = []
+    w = out.append
+    w("/* %s 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */" % spec["ip"])
+    w("#ifndef %s" % guard)
+    w("#define %s" % guard)
+    w("")
+    for r in spec["regs"]:
+        name = "%s_%s_OFFSET" % (ip, r["name"].upper())
+        desc = r.get("desc", "")
+        w("#define %-36s 0x%02X%s" % (name, r["offset"], ("    /* %s */" % desc) if desc else ""))
+    for r in spec["regs"]:
+        for f in r.get("fields", []):
+            name = "%s_%s_%s" % (ip, r["name"].upper(), f["name"].upper())
+            w("#define %-36s (1u << %d)" % (name, f["bit"]))
+    w("")
+    w("#endif")
+    return "\n".join(out) + "\n"
+
+
+def targets(ip_dir, spec):
+    ip = spec["ip"]
+    return [
+        (os.path.join(ip_dir, "hdl", "%s_regs.v" % ip), gen_verilog(spec)),
+        (os.path.join(ip_dir, "drivers", "%s_v1_0" % ip, "src", "%s_regs.h" % ip), gen_header(spec)),
+    ]
+
+
+def sync():
+    src = os.path.join(ROOT, "common", "hdl", "axil_slave_pipe.v")
+    for d in sorted(os.listdir(ROOT)):
+        hdl = os.path.join(ROOT, d, "hdl")
+        if d.startswith("myip_") and os.path.isdir(hdl):
+            shutil.copyfile(src, os.path.join(hdl, "axil_slave_pipe.v"))
+            print("synced", d)
+
+
+def main(argv):
+    if argv == ["--sync"]:
+        sync()
+        return 0
+    check = "--check" in argv
+    dirs = [a for a in argv if not a.startswith("--")]
+    if not dirs:
+        print(__doc__)
+        return 2
+    stale = 0
+    for d in dirs:
+        ip_dir = d if os.path.isabs(d) else os.path.join(ROOT, d)
+        spec = load(ip_dir)
+        for path, text in targets(ip_dir, spec):
+            old = open(path, encoding="utf-8").read() if os.path.exists(path) else None
+            if old == text:
+                continue
+            if check:
+                print("stale:", os.path.relpath(path, ROOT))
+                stale += 1
+            else:
+                with open(path, "w", encoding="utf-8") as f:
+                    f.write(text)
+                print("wrote", os.path.relpath(path, ROOT))
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -15,6 +15,39 @@
 #define MYIP_ADC_NEW_S00_AXI_SLV_REG5_OFFSET 20
 #define MYIP_ADC_NEW_S00_AXI_SLV_REG6_OFFSET 24
 #define MYIP_ADC_NEW_S00_AXI_SLV_REG7_OFFSET 28
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG8_OFFSET 32
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG9_OFFSET 36
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG10_OFFSET 40
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG11_OFFSET 44
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG12_OFFSET 48
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG13_OFFSET 52
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG14_OFFSET 56
+#define MYIP_ADC_NEW_S00_AXI_SLV_REG15_OFFSET 60
+
+/* REG0~3: [11:0] 원시값, [27:16] 필터값 */
+#define MYIP_ADC_NEW_RAW(Reg)       ((Reg) & 0xFFF)
+#define MYIP_ADC_NEW_FILT(Reg)      (((Reg) >> 16) & 0xFFF)
+
+/* REG4: 필터 제어 [3:0] IIR 시프트(0=바이패스), [4] 3-tap 미디언 사용 */
+#define MYIP_ADC_NEW_FILTER_CTRL_OFFSET MYIP_ADC_NEW_S00_AXI_SLV_REG4_OFFSET
+#define MYIP_ADC_NEW_FILTER_MEDIAN  (1 << 4)
+#define MYIP_ADC_NEW_FILTER_SHIFT(n) ((n) & 0xF)
+
+/* REG5: 변화 검출 제어 [3:0] 채널 사용, [8] 인터럽트 허용, [9] 필터값 비교 */
+#define MYIP_ADC_NEW_CMP_CTRL_OFFSET    MYIP_ADC_NEW_S00_AXI_SLV_REG5_OFFSET
+#define MYIP_ADC_NEW_CMP_IRQ_EN     (1 << 8)
+#define MYIP_ADC_NEW_CMP_USE_FILT   (1 << 9)
+
+/* REG6 (읽기 전용): [3:0] 변화 채널 (읽으면 클리어), [7:4] 데드존 밖 */
+#define MYIP_ADC_NEW_CHANGED_OFFSET     MYIP_ADC_NEW_S00_AXI_SLV_REG6_OFFSET
+
+/* REG8~11: 채널 n {데드존[27:16], 중립[11:0]} */
+#define MYIP_ADC_NEW_ZONE_OFFSET(n)     (MYIP_ADC_NEW_S00_AXI_SLV_REG8_OFFSET + (n) * 4)
+#define MYIP_ADC_NEW_ZONE(neutral, dz)  ((((dz) & 0xFFF) << 16) | ((neutral) & 0xFFF))
+
+/* REG12~15: 채널 n 변화 임계값[11:0], 읽으면 [27:16]에 마지막 보고값 */
+#define MYIP_ADC_NEW_THRESH_OFFSET(n)   (MYIP_ADC_NEW_S00_AXI_SLV_REG12_OFFSET + (n) * 4)
+#define MYIP_ADC_NEW_REPORTED(Reg)      (((Reg) >> 16) & 0xFFF)
 
 
 /**************************** Type Definitions *****************************/
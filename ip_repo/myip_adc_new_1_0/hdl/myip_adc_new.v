@@ -11,7 +11,7 @@
 
 		// Parameters of Axi Slave Bus Interface S00_AXI
 		parameter integer C_S00_AXI_DATA_WIDTH	= 32,
-		parameter integer C_S00_AXI_ADDR_WIDTH	= 5
+		parameter integer C_S00_AXI_ADDR_WIDTH	= 6
 	)
 	(
 		// Users to add ports here
@@ -26,6 +26,7 @@ input vauxp7,
 input vauxn7,
 input vauxp15,
 input vauxn15,
+output adc_intr,
 
 		// Ports of Axi Slave Bus Interface S00_AXI
 		input wire  s00_axi_aclk,
@@ -63,6 +64,7 @@ input vauxn15,
 .vauxn7(vauxn7),
  .vauxp15(vauxp15),
 .vauxn15(vauxn15),
+.adc_intr(adc_intr),
 
 
 		.S_AXI_ACLK(s00_axi_aclk),
@@ -11,7 +11,7 @@
 		// Width of S_AXI data bus
 		parameter integer C_S_AXI_DATA_WIDTH	= 32,
 		// Width of S_AXI address bus
-		parameter integer C_S_AXI_ADDR_WIDTH	= 5
+		parameter integer C_S_AXI_ADDR_WIDTH	= 6
 	)
 	(
 		// Users to add ports here
@@ -23,6 +23,7 @@ input vauxp7,
 input vauxn7,
 input vauxp15,
 input vauxn15,
+output adc_intr,
 		// User ports ends
 		// Do not modify the ports beyond this line
 
@@ -90,28 +91,17 @@ input vauxn15,
 wire [4:0]  channel_out_wire;  // XADC 선택 채널 출력
 wire [15:0] do_out_wire;       // XADC 변환 데이터
 wire        eoc_out_wire;      // End of Conversion 신호
-	// AXI4LITE signals
-	reg [C_S_AXI_ADDR_WIDTH-1 : 0] 	axi_awaddr;
-	reg  	axi_awready;
-	reg  	axi_wready;
-	reg [1 : 0] 	axi_bresp;
-	reg  	axi_bvalid;
-	reg [C_S_AXI_ADDR_WIDTH-1 : 0] 	axi_araddr;
-	reg  	axi_arready;
-	reg [1 : 0] 	axi_rresp;
-	reg  	axi_rvalid;
-
 	// Example-specific design signals
 	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
 	// ADDR_LSB is used for addressing 32/64 bit registers/memories
 	// ADDR_LSB = 2 for 32 bits (n downto 2)
 	// ADDR_LSB = 3 for 64 bits (n downto 3)
 	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
-	localparam integer OPT_MEM_ADDR_BITS = 2;
+	localparam integer OPT_MEM_ADDR_BITS = 3;
 	//----------------------------------------------
 	//-- Signals for user logic register space example
 	//------------------------------------------------
-	//-- Number of Slave Registers 8
+	//-- Number of Slave Registers 16
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg0;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg1;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg2;
@@ -120,97 +110,59 @@ wire        eoc_out_wire;      // End of Conversion 신호
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg5;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg6;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg7;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg8;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg9;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg10;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg11;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg12;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg13;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg14;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg15;
 	integer	 byte_index;
 
-	// I/O Connections assignments
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
 
-	assign S_AXI_AWREADY	= axi_awready;
-	assign S_AXI_WREADY	= axi_wready;
-	assign S_AXI_BRESP	= axi_bresp;
-	assign S_AXI_BVALID	= axi_bvalid;
-	assign S_AXI_ARREADY	= axi_arready;
-	assign S_AXI_RRESP	= axi_rresp;
-	assign S_AXI_RVALID	= axi_rvalid;
-	 //state machine varibles 
-	 reg [1:0] state_write;
-	 reg [1:0] state_read;
-	 //State machine local parameters
-	 localparam Idle = 2'b00,Raddr = 2'b10,Rdata = 2'b11 ,Waddr = 2'b10,Wdata = 2'b11;
-	// Implement Write state machine
-	// Outstanding write transactions are not supported by the slave i.e., master should assert bready to receive response on or before it starts sending the new transaction
-	always @(posedge S_AXI_ACLK)                                 
-	  begin                                 
-	     if (S_AXI_ARESETN == 1'b0)                                 
-	       begin                                 
-	         axi_awready <= 0;                                 
-	         axi_wready <= 0;                                 
-	         axi_bvalid <= 0;                                 
-	         axi_bresp <= 0;                                 
-	         axi_awaddr <= 0;                                 
-	         state_write <= Idle;                                 
-	       end                                 
-	     else                                  
-	       begin                                 
-	         case(state_write)                                 
-	           Idle:                                      
-	             begin                                 
-	               if(S_AXI_ARESETN == 1'b1)                                  
-	                 begin                                 
-	                   axi_awready <= 1'b1;                                 
-	                   axi_wready <= 1'b1;                                 
-	                   state_write <= Waddr;                                 
-	                 end                                 
-	               else state_write <= state_write;                                 
-	             end                                 
-	           Waddr:        //At this state, slave is ready to receive address along with corresponding control signals and first data packet. Response valid is also handled at this state                                 
-	             begin                                 
-	               if (S_AXI_AWVALID && S_AXI_AWREADY)                                 
-	                  begin                                 
-	                    axi_awaddr <= S_AXI_AWADDR;                                 
-	                    if(S_AXI_WVALID)                                  
-	                      begin                                   
-	                        axi_awready <= 1'b1;                                 
-	                        state_write <= Waddr;                                 
-	                        axi_bvalid <= 1'b1;                                 
-	                      end                                 
-	                    else                                  
-	                      begin                                 
-	                        axi_awready <= 1'b0;                                 
-	                        state_write <= Wdata;                                 
-	                        if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                      end                                 
-	                  end                                 
-	               else                                  
-	                  begin                                 
-	                    state_write <= state_write;                                 
-	                    if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                   end                                 
-	             end                                 
-	          Wdata:        //At this state, slave is ready to receive the data packets until the number of transfers is equal to burst length                                 
-	             begin                                 
-	               if (S_AXI_WVALID)                                 
-	                 begin                                 
-	                   state_write <= Waddr;                                 
-	                   axi_bvalid <= 1'b1;                                 
-	                   axi_awready <= 1'b1;                                 
-	                 end                                 
-	                else                                  
-	                 begin                                 
-	                   state_write <= state_write;                                 
-	                   if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                 end                                              
-	             end                                 
-	          endcase                                 
-	        end                                 
-	      end                                 
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
 
 	// Implement memory mapped register select and write logic generation
-	// The write data is accepted and written to memory mapped registers when
-	// axi_awready, S_AXI_WVALID, axi_wready and S_AXI_WVALID are asserted. Write strobes are used to
-	// select byte enables of slave registers while writing.
-	// These registers are cleared when reset (active low) is applied.
-	// Slave register write enable is asserted when valid address and data are available
-	// and the slave is ready to accept the write address and write data.
+	// wr_en: AW/W를 수락한 클럭, wr_idx: 그때의 레지스터 번호
 	 
 
 	always @( posedge S_AXI_ACLK )
@@ -225,67 +177,131 @@ wire        eoc_out_wire;      // End of Conversion 신호
 	      slv_reg5 <= 0;
 	      slv_reg6 <= 0;
 	      slv_reg7 <= 0;
+	      slv_reg8 <= 0;
+	      slv_reg9 <= 0;
+	      slv_reg10 <= 0;
+	      slv_reg11 <= 0;
+	      slv_reg12 <= 0;
+	      slv_reg13 <= 0;
+	      slv_reg14 <= 0;
+	      slv_reg15 <= 0;
 	    end 
 	  else begin
-	    if (S_AXI_WVALID)
+	    if (wr_en)
 	      begin
-	        case ( (S_AXI_AWVALID) ? S_AXI_AWADDR[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] : axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
-	          3'h0:
+	        case ( wr_idx )
+	          4'h0:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 0
 	                slv_reg0[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h1:
+	          4'h1:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 1
 	                slv_reg1[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h2:
+	          4'h2:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 2
 	                slv_reg2[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h3:
+	          4'h3:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 3
 	                slv_reg3[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h4:
+	          4'h4:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 4
 	                slv_reg4[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h5:
+	          4'h5:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 5
 	                slv_reg5[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h6:
+	          4'h6:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 6
 	                slv_reg6[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          3'h7:
+	          4'h7:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 7
 	                slv_reg7[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
+	          4'h8:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 8
+	                slv_reg8[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'h9:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 9
+	                slv_reg9[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hA:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 10
+	                slv_reg10[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hB:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 11
+	                slv_reg11[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hC:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 12
+	                slv_reg12[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hD:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 13
+	                slv_reg13[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hE:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 14
+	                slv_reg14[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
+	          4'hF:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                // Respective byte enables are asserted as per write strobes 
+	                // Slave register 15
+	                slv_reg15[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end  
 	          default : begin
 	                      slv_reg0 <= slv_reg0;
 	                      slv_reg1 <= slv_reg1;
@@ -295,74 +311,49 @@ wire        eoc_out_wire;      // End of Conversion 신호
 	                      slv_reg5 <= slv_reg5;
 	                      slv_reg6 <= slv_reg6;
 	                      slv_reg7 <= slv_reg7;
+	                      slv_reg8 <= slv_reg8;
+	                      slv_reg9 <= slv_reg9;
+	                      slv_reg10 <= slv_reg10;
+	                      slv_reg11 <= slv_reg11;
+	                      slv_reg12 <= slv_reg12;
+	                      slv_reg13 <= slv_reg13;
+	                      slv_reg14 <= slv_reg14;
+	                      slv_reg15 <= slv_reg15;
 	                    end
 	        endcase
 	      end
 	  end
 	end    
 
-	// Implement read state machine
-	  always @(posedge S_AXI_ACLK)                                       
-	    begin                                       
-	      if (S_AXI_ARESETN == 1'b0)                                       
-	        begin                                       
-	         //asserting initial values to all 0's during reset                                       
-	         axi_arready <= 1'b0;                                       
-	         axi_rvalid <= 1'b0;                                       
-	         axi_rresp <= 1'b0;                                       
-	         state_read <= Idle;                                       
-	        end                                       
-	      else                                       
-	        begin                                       
-	          case(state_read)                                       
-	            Idle:     //Initial state inidicating reset is done and ready to receive read/write transactions                                       
-	              begin                                                
-	                if (S_AXI_ARESETN == 1'b1)                                        
-	                  begin                                       
-	                    state_read <= Raddr;                                       
-	                    axi_arready <= 1'b1;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	            Raddr:        //At this state, slave is ready to receive address along with corresponding control signals                                       
-	              begin                                       
-	                if (S_AXI_ARVALID && S_AXI_ARREADY)                                       
-	                  begin                                       
-	                    state_read <= Rdata;                                       
-	                    axi_araddr <= S_AXI_ARADDR;                                       
-	                    axi_rvalid <= 1'b1;                                       
-	                    axi_arready <= 1'b0;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	            Rdata:        //At this state, slave is ready to send the data packets until the number of transfers is equal to burst length                                       
-	              begin                                           
-	                if (S_AXI_RVALID && S_AXI_RREADY)                                       
-	                  begin                                       
-	                    axi_rvalid <= 1'b0;                                       
-	                    axi_arready <= 1'b1;                                       
-	                    state_read <= Raddr;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	           endcase                                       
-	          end                                       
-	        end                                      
-	           
 	// Implement memory mapped register select and read logic generation
 	wire [11:0] adc_value_x;
 	wire [11:0] adc_value_y;
 		wire [11:0] adc_value_x2;
 	wire [11:0] adc_value_y2;
-	  assign S_AXI_RDATA = 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h0) ? {20'd0, adc_value_x} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h1) ? {20'd0, adc_value_y} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h2) ? {20'd0, adc_value_x2} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h3) ? {20'd0, adc_value_y2} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h4) ? slv_reg4 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h5) ? slv_reg5 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h6) ? slv_reg6 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h7) ? slv_reg7 : 0; 
+	// 필터 값은 같은 레지스터 상위 16비트에 (원본과 한 번에 읽힘)
+	wire [11:0] adc_filt_x, adc_filt_y, adc_filt_x2, adc_filt_y2;
+	wire [3:0] adc_update;             // 채널별 새 샘플 (필터 출력 갱신) 펄스
+	// 변화 검출: 채널별 마지막 보고값, 변화 플래그, 데드존 밖 여부
+	wire [11:0] cmp_reported [0:3];
+	reg [3:0] changed_evt;
+	wire [3:0] outside_dz;
+	  assign rd_data = 
+	  (rd_idx == 4'h0) ? {4'd0, adc_filt_x, 4'd0, adc_value_x} : 
+	  (rd_idx == 4'h1) ? {4'd0, adc_filt_y, 4'd0, adc_value_y} : 
+	  (rd_idx == 4'h2) ? {4'd0, adc_filt_x2, 4'd0, adc_value_x2} : 
+	  (rd_idx == 4'h3) ? {4'd0, adc_filt_y2, 4'd0, adc_value_y2} : 
+	  (rd_idx == 4'h4) ? slv_reg4 : 
+	  (rd_idx == 4'h5) ? slv_reg5 : 
+	  (rd_idx == 4'h6) ? {24'd0, outside_dz, changed_evt} : 
+	  (rd_idx == 4'h7) ? slv_reg7 : 
+	  (rd_idx == 4'h8) ? slv_reg8 : 
+	  (rd_idx == 4'h9) ? slv_reg9 : 
+	  (rd_idx == 4'hA) ? slv_reg10 : 
+	  (rd_idx == 4'hB) ? slv_reg11 : 
+	  (rd_idx == 4'hC) ? {4'd0, cmp_reported[0], 4'd0, slv_reg12[11:0]} : 
+	  (rd_idx == 4'hD) ? {4'd0, cmp_reported[1], 4'd0, slv_reg13[11:0]} : 
+	  (rd_idx == 4'hE) ? {4'd0, cmp_reported[2], 4'd0, slv_reg14[11:0]} : 
+	  (rd_idx == 4'hF) ? {4'd0, cmp_reported[3], 4'd0, slv_reg15[11:0]} : 0; 
 	// Add user logic here
 adc_sequence2_top_myip adc_int (
     .clk(S_AXI_ACLK),
@@ -375,15 +366,59 @@ adc_sequence2_top_myip adc_int (
     .vauxn7(vauxn7),
     .vauxp15(vauxp15),
     .vauxn15(vauxn15),
+    .median_en(slv_reg4[4]),        // 필터 설정: [3:0] IIR shift, [4] 미디언
+    .iir_shift(slv_reg4[3:0]),
     .adc_value_x(adc_value_x),      // 필요 시 AXI 레지스터에 바로 연결
     .adc_value_y(adc_value_y),
      .adc_value_x2(adc_value_x2),      // 필요 시 AXI 레지스터에 바로 연결
     .adc_value_y2(adc_value_y2),
+    .adc_filt_x(adc_filt_x),
+    .adc_filt_y(adc_filt_y),
+    .adc_filt_x2(adc_filt_x2),
+    .adc_filt_y2(adc_filt_y2),
+    .adc_update(adc_update),
     .channel_out(channel_out_wire),
     .do_out(do_out_wire),
     .eoc_out(eoc_out_wire)
 );
 
+
+// 변화 검출 (0x14: [3:0] 채널 사용, [8] 인터럽트 허용, [9] 1=필터값 0=원시값 비교)
+// 채널 설정: 0x20+4n = {데드존[27:16], 중립[11:0]}, 0x30+4n = 변화 임계값[11:0]
+// 0x30+4n 읽기 시 [27:16]에 마지막 보고값 (데드존 안이면 중립으로 고정된 값)
+wire [11:0] cmp_value [0:3];
+assign cmp_value[0] = slv_reg5[9] ? adc_filt_x  : adc_value_x;
+assign cmp_value[1] = slv_reg5[9] ? adc_filt_y  : adc_value_y;
+assign cmp_value[2] = slv_reg5[9] ? adc_filt_x2 : adc_value_x2;
+assign cmp_value[3] = slv_reg5[9] ? adc_filt_y2 : adc_value_y2;
+
+wire [3:0] cmp_changed;
+
+adc_change_detect cmp_x (.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(slv_reg5[0]), .sample_valid(adc_update[0]),
+    .value(cmp_value[0]), .neutral(slv_reg8[11:0]), .deadzone(slv_reg8[27:16]), .threshold(slv_reg12[11:0]),
+    .reported(cmp_reported[0]), .changed(cmp_changed[0]), .outside_dz(outside_dz[0]));
+adc_change_detect cmp_y (.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(slv_reg5[1]), .sample_valid(adc_update[1]),
+    .value(cmp_value[1]), .neutral(slv_reg9[11:0]), .deadzone(slv_reg9[27:16]), .threshold(slv_reg13[11:0]),
+    .reported(cmp_reported[1]), .changed(cmp_changed[1]), .outside_dz(outside_dz[1]));
+adc_change_detect cmp_x2 (.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(slv_reg5[2]), .sample_valid(adc_update[2]),
+    .value(cmp_value[2]), .neutral(slv_reg10[11:0]), .deadzone(slv_reg10[27:16]), .threshold(slv_reg14[11:0]),
+    .reported(cmp_reported[2]), .changed(cmp_changed[2]), .outside_dz(outside_dz[2]));
+adc_change_detect cmp_y2 (.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(slv_reg5[3]), .sample_valid(adc_update[3]),
+    .value(cmp_value[3]), .neutral(slv_reg11[11:0]), .deadzone(slv_reg11[27:16]), .threshold(slv_reg15[11:0]),
+    .reported(cmp_reported[3]), .changed(cmp_changed[3]), .outside_dz(outside_dz[3]));
+
+// 변화 채널 마스크 (0x18 [3:0]): CPU가 읽을 때까지 유지, 읽으면 클리어
+wire rd_done = rd_en;    // 읽기 주소를 받은 클럭에 값이 RDATA로 잡히므로 그 클럭에 클리어
+wire rd_changed = rd_done && (rd_idx == 4'h6);
+
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) changed_evt <= 4'd0;
+    else changed_evt <= (rd_changed ? 4'd0 : changed_evt) | cmp_changed;
+end
+
+// 인터럽트 (레벨)
+assign adc_intr = slv_reg5[8] & (|changed_evt);
+
 	// User logic ends
 
 	endmodule
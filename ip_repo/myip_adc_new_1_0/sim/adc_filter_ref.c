@@ -0,0 +1,106 @@
+/*
+ * adc_median_iir C 기준 모델 (src/test_top.v 의 adc_median_iir 와 비트 단위로 같아야 함)
+ *
+ *   adc_filter_ref <median_en> <iir_shift> <samples.hex> <expected.hex>
+ *       samples.hex 의 12비트 샘플을 필터링해서 expected.hex 로 출력
+ *   adc_filter_ref gen <count> <samples.hex>
+ *       중립 근처 스틱 잡음 트레이스 생성 (보드 캡처가 없을 때 사용)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+    uint16_t h0, h1, h2;
+    int primed;
+    uint32_t acc;       // 12.8 고정소수점
+    int acc_primed;
+} adc_filt_t;
+
+static uint16_t median3(uint16_t a, uint16_t b, uint16_t c)
+{
+    uint16_t lo = a < b ? a : b;
+    uint16_t hi = a < b ? b : a;
+    uint16_t m = hi < c ? hi : c;
+    return lo > m ? lo : m;
+}
+
+// 산술 시프트 (음수는 -inf 방향 내림, 하드웨어 >>> 와 동일)
+static int32_t asr(int32_t v, int k)
+{
+    return v >= 0 ? (v >> k) : -(int32_t)(((uint32_t)-v + (1u << k) - 1) >> k);
+}
+
+static uint16_t adc_filt_step(adc_filt_t *f, uint16_t sample, int median_en, int iir_shift)
+{
+    f->h2 = f->primed ? f->h1 : sample;
+    f->h1 = f->primed ? f->h0 : sample;
+    f->h0 = sample;
+    f->primed = 1;
+
+    uint16_t x = median_en ? median3(f->h0, f->h1, f->h2) : f->h0;
+
+    if (!f->acc_primed || iir_shift == 0) {
+        f->acc = (uint32_t)x << 8;
+    } else {
+        int32_t diff = (int32_t)((uint32_t)x << 8) - (int32_t)f->acc;
+        f->acc = (uint32_t)((int32_t)f->acc + asr(diff, iir_shift)) & 0xFFFFF;
+    }
+    f->acc_primed = 1;
+
+    return (uint16_t)(f->acc >> 8);
+}
+
+// 중립(2048) 부근 잡음 + 가끔 튀는 값 + 데드존 경계 근처로 천천히 움직이는 스틱
+static int gen_trace(int count, const char *path)
+{
+    FILE *out = fopen(path, "w");
+    if (!out) return 1;
+
+    uint32_t lcg = 12345;
+    for (int i = 0; i < count; i++) {
+        lcg = lcg * 1103515245u + 12345u;
+        int noise = (int)((lcg >> 16) % 41) - 20;
+        int base = 2048 + ((i / 64) % 4) * 100;     // 2048 → 2348 계단
+        int v = base + noise;
+        if ((lcg >> 8) % 37 == 0) v += ((lcg >> 4) & 1) ? 600 : -600;  // 스파이크
+        if (v < 0) v = 0;
+        if (v > 4095) v = 4095;
+        fprintf(out, "%03x\n", v);
+    }
+    fclose(out);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && strcmp(argv[1], "gen") == 0) {
+        return gen_trace(atoi(argv[2]), argv[3]);
+    }
+    if (argc != 5) {
+        fprintf(stderr, "usage: %s <median_en> <iir_shift> <samples.hex> <expected.hex>\n"
+                        "       %s gen <count> <samples.hex>\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    int median_en = atoi(argv[1]);
+    int iir_shift = atoi(argv[2]) & 0xF;
+    FILE *in = fopen(argv[3], "r");
+    FILE *out = fopen(argv[4], "w");
+    if (!in || !out) {
+        fprintf(stderr, "cannot open files\n");
+        return 1;
+    }
+
+    adc_filt_t f;
+    memset(&f, 0, sizeof(f));
+    unsigned v;
+    while (fscanf(in, "%x", &v) == 1) {
+        fprintf(out, "%03x\n", adc_filt_step(&f, (uint16_t)(v & 0xFFF), median_en, iir_shift));
+    }
+
+    fclose(in);
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/bin/sh
+# adc_median_iir 테스트벤치 실행
+#   ./run_sim.sh [median_en] [iir_shift]
+# C 기준 모델로 기대값을 만든 뒤 xsim(Vivado) 또는 iverilog 로 돌린다.
+set -e
+cd "$(dirname "$0")"
+
+MEDIAN_EN=${1:-1}
+IIR_SHIFT=${2:-3}
+
+cc -O2 -o adc_filter_ref adc_filter_ref.c
+./adc_filter_ref "$MEDIAN_EN" "$IIR_SHIFT" adc_noisy_samples.hex adc_filter_expected.hex
+
+# test_top.v 전체는 XADC IP가 필요하므로 필터 모듈만 뽑아서 컴파일
+sed -n '/^module adc_median_iir(/,/^endmodule/p' ../src/test_top.v > adc_median_iir_dut.v
+
+if command -v xvlog >/dev/null 2>&1; then
+    xvlog adc_median_iir_dut.v tb_adc_median_iir.v
+    xelab -generic_top "MEDIAN_EN=$MEDIAN_EN" -generic_top "IIR_SHIFT=$IIR_SHIFT" tb_adc_median_iir -s tb_adc_median_iir
+    xsim tb_adc_median_iir -R | tee sim.log
+else
+    iverilog -o tb_adc_median_iir.vvp -P tb_adc_median_iir.MEDIAN_EN="$MEDIAN_EN" \
+        -P tb_adc_median_iir.IIR_SHIFT="$IIR_SHIFT" adc_median_iir_dut.v tb_adc_median_iir.v
+    vvp tb_adc_median_iir.vvp | tee sim.log
+fi
+
+grep -q '^PASS' sim.log
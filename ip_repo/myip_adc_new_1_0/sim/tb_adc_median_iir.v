@@ -0,0 +1,84 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// adc_median_iir 자가 검증 테스트벤치
+//
+// adc_noisy_samples.hex 를 XADC 변환 주기처럼 펄스로 넣고,
+// 필터 출력을 C 기준 모델(adc_filter_ref.c)이 만든 기대값과 비교한다.
+// 실행은 run_sim.sh 참고 (기대값 생성 → xsim 또는 iverilog)
+//////////////////////////////////////////////////////////////////////////////////
+
+module tb_adc_median_iir;
+
+parameter MEDIAN_EN = 1;
+parameter IIR_SHIFT = 3;
+parameter N_SAMPLES = 1024;
+
+reg clk = 0;
+reg reset_p = 1;
+reg sample_valid = 0;
+reg [11:0] sample = 0;
+
+wire [11:0] filtered;
+wire filtered_valid;
+
+reg [11:0] samples [0:N_SAMPLES-1];
+reg [11:0] expected [0:N_SAMPLES-1];
+
+adc_median_iir dut(
+    .clk(clk),
+    .reset_p(reset_p),
+    .sample_valid(sample_valid),
+    .sample(sample),
+    .median_en(MEDIAN_EN[0]),
+    .iir_shift(IIR_SHIFT[3:0]),
+    .filtered(filtered),
+    .filtered_valid(filtered_valid)
+);
+
+always #5 clk = ~clk;   // 100MHz
+
+integer in_idx = 0;
+integer out_idx = 0;
+integer errors = 0;
+
+// 출력 확인
+always @(posedge clk) begin
+    if (filtered_valid) begin
+        if (filtered !== expected[out_idx]) begin
+            if (errors < 10)
+                $display("MISMATCH [%0d] in=%h got=%h exp=%h", out_idx, samples[out_idx], filtered, expected[out_idx]);
+            errors = errors + 1;
+        end
+        out_idx = out_idx + 1;
+    end
+end
+
+initial begin
+    $readmemh("adc_noisy_samples.hex", samples);
+    $readmemh("adc_filter_expected.hex", expected);
+
+    repeat (5) @(posedge clk);
+    reset_p = 0;
+
+    // XADC 시퀀서처럼 몇 클럭 간격으로 변환값 도착
+    for (in_idx = 0; in_idx < N_SAMPLES; in_idx = in_idx + 1) begin
+        @(posedge clk);
+        sample <= samples[in_idx];
+        sample_valid <= 1;
+        @(posedge clk);
+        sample_valid <= 0;
+        repeat (6) @(posedge clk);
+    end
+    repeat (10) @(posedge clk);
+
+    if (out_idx != N_SAMPLES) begin
+        $display("FAIL: %0d outputs for %0d samples", out_idx, N_SAMPLES);
+        errors = errors + 1;
+    end
+
+    if (errors == 0) $display("PASS: %0d samples (median=%0d shift=%0d)", N_SAMPLES, MEDIAN_EN, IIR_SHIFT);
+    else $display("FAIL: %0d mismatches", errors);
+    $finish;
+end
+
+endmodule
@@ -1827,6 +1827,115 @@ module myip_adc_controller #(
     end
 
 endmodule
+// 3탭 미디언 + 1차 IIR 입력 필터 (채널 1개)
+// y <= y + (x - y) >>> iir_shift, 누산기는 소수부 8비트
+// C 기준 모델: sim/adc_filter_ref.c (수식이 바뀌면 같이 수정)
+module adc_median_iir(
+    input clk,
+    input reset_p,
+    input sample_valid,          // 새 변환값 1클럭 펄스
+    input [11:0] sample,
+    input median_en,             // 0: 미디언 건너뜀
+    input [3:0] iir_shift,       // 0: IIR 건너뜀
+    output [11:0] filtered,
+    output reg filtered_valid
+);
+
+    // 최근 샘플 3개 (첫 샘플로 채워서 시작)
+    reg [11:0] h0, h1, h2;
+    reg primed;
+    reg stage1;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            h0 <= 0;
+            h1 <= 0;
+            h2 <= 0;
+            primed <= 0;
+            stage1 <= 0;
+        end
+        else begin
+            stage1 <= sample_valid;
+            if (sample_valid) begin
+                h0 <= sample;
+                h1 <= primed ? h0 : sample;
+                h2 <= primed ? h1 : sample;
+                primed <= 1;
+            end
+        end
+    end
+
+    // median3 = max(min(h0,h1), min(max(h0,h1), h2))
+    wire [11:0] lo01 = (h0 < h1) ? h0 : h1;
+    wire [11:0] hi01 = (h0 < h1) ? h1 : h0;
+    wire [11:0] mid2 = (hi01 < h2) ? hi01 : h2;
+    wire [11:0] med  = (lo01 > mid2) ? lo01 : mid2;
+    wire [11:0] x    = median_en ? med : h0;
+
+    reg [19:0] acc;
+    reg acc_primed;
+    wire signed [20:0] diff = $signed({1'b0, x, 8'd0}) - $signed({1'b0, acc});
+    wire signed [20:0] step = diff >>> iir_shift;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            acc <= 0;
+            acc_primed <= 0;
+            filtered_valid <= 0;
+        end
+        else begin
+            filtered_valid <= stage1;
+            if (stage1) begin
+                if (!acc_primed || iir_shift == 0) acc <= {x, 8'd0};
+                else acc <= acc + step[19:0];
+                acc_primed <= 1;
+            end
+        end
+    end
+
+    assign filtered = acc[19:8];
+
+endmodule
+
+// 채널 변화 검출: 데드존 안은 중립으로 고정한 뒤 마지막 보고값과 비교
+// 임계값 이상 움직였거나 데드존으로 돌아왔을 때만 보고값 갱신 + changed 펄스
+module adc_change_detect(
+    input clk,
+    input reset_p,
+    input enable,
+    input sample_valid,          // 새 샘플 1클럭 펄스
+    input [11:0] value,
+    input [11:0] neutral,
+    input [11:0] deadzone,       // |value - neutral| <= deadzone 이면 중립
+    input [11:0] threshold,      // 보고값 대비 최소 변화량 (0이면 모든 변화)
+    output reg [11:0] reported,
+    output reg changed,
+    output outside_dz
+);
+
+    wire [11:0] dist_n = (value >= neutral) ? value - neutral : neutral - value;
+    assign outside_dz = dist_n > deadzone;
+
+    wire [11:0] snapped = outside_dz ? value : neutral;
+    wire [11:0] dist_r = (snapped >= reported) ? snapped - reported : reported - snapped;
+    wire cross = (snapped != reported) && (dist_r >= threshold || !outside_dz);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            reported <= 0;
+            changed <= 0;
+        end
+        else begin
+            changed <= 0;
+            if (enable && sample_valid && cross) begin
+                reported <= snapped;
+                changed <= 1;
+            end
+        end
+    end
+
+endmodule
+
 module adc_sequence2_top_myip(
     input clk,
     input reset_p,
@@ -1838,10 +1947,17 @@ module adc_sequence2_top_myip(
     input vauxn7, 
     input vauxp15,
     input vauxn15,
+    input median_en,                 // 필터: 미디언 사용
+    input [3:0] iir_shift,           // 필터: IIR 계수 (0이면 IIR 끔)
     output reg [11:0] adc_value_x,   // ADC 채널 6 값
     output reg [11:0] adc_value_y,   // ADC 채널 14 값
     output reg [11:0] adc_value_x2,  // ADC 채널 7 값
     output reg [11:0] adc_value_y2,  // ADC 채널 15 값
+    output [11:0] adc_filt_x,        // 필터 거친 값
+    output [11:0] adc_filt_y,
+    output [11:0] adc_filt_x2,
+    output [11:0] adc_filt_y2,
+    output [3:0] adc_update,         // 채널별 필터값 갱신 펄스
     output [4:0] channel_out,        // 선택된 채널 출력
     output [15:0] do_out,            // XADC 변환 결과
     output eoc_out                   // 변환 완료 신호
@@ -1877,21 +1993,35 @@ module adc_sequence2_top_myip(
     );
 
     // ADC 값 저장
+    reg [3:0] ch_update;   // 어느 채널이 갱신됐는지 (다음 클럭에 필터로)
     always @(posedge clk or posedge reset_p) begin
         if (reset_p) begin
             adc_value_x  <= 0;
             adc_value_y  <= 0;
             adc_value_x2 <= 0;
             adc_value_y2 <= 0;
+            ch_update <= 0;
         end
         else if (eoc_pedge) begin
+            ch_update <= 0;
             case(channel_out[3:0])
-                6:  adc_value_x  <= do_out[15:4]; // 상위 12비트
-                14: adc_value_y <= do_out[15:4];
-                7:  adc_value_x2 <= do_out[15:4];
-                15: adc_value_y2 <= do_out[15:4];
+                6:  begin adc_value_x  <= do_out[15:4]; ch_update[0] <= 1; end // 상위 12비트
+                14: begin adc_value_y  <= do_out[15:4]; ch_update[1] <= 1; end
+                7:  begin adc_value_x2 <= do_out[15:4]; ch_update[2] <= 1; end
+                15: begin adc_value_y2 <= do_out[15:4]; ch_update[3] <= 1; end
             endcase
         end
+        else ch_update <= 0;
     end
 
+    // 채널별 입력 필터
+    adc_median_iir filt_x (.clk(clk), .reset_p(reset_p), .sample_valid(ch_update[0]), .sample(adc_value_x),
+        .median_en(median_en), .iir_shift(iir_shift), .filtered(adc_filt_x), .filtered_valid(adc_update[0]));
+    adc_median_iir filt_y (.clk(clk), .reset_p(reset_p), .sample_valid(ch_update[1]), .sample(adc_value_y),
+        .median_en(median_en), .iir_shift(iir_shift), .filtered(adc_filt_y), .filtered_valid(adc_update[1]));
+    adc_median_iir filt_x2 (.clk(clk), .reset_p(reset_p), .sample_valid(ch_update[2]), .sample(adc_value_x2),
+        .median_en(median_en), .iir_shift(iir_shift), .filtered(adc_filt_x2), .filtered_valid(adc_update[2]));
+    adc_median_iir filt_y2 (.clk(clk), .reset_p(reset_p), .sample_valid(ch_update[3]), .sample(adc_value_y2),
+        .median_en(median_en), .iir_shift(iir_shift), .filtered(adc_filt_y2), .filtered_valid(adc_update[3]));
+
 endmodule
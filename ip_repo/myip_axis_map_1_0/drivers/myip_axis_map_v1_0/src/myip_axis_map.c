@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_axis_map.h"
+
+/************************** Function Definitions ***************************/
@@ -0,0 +1,96 @@
+
+#ifndef MYIP_AXIS_MAP_H
+#define MYIP_AXIS_MAP_H
+
+
+/****************** Include Files ********************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG0_OFFSET 0
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG1_OFFSET 4
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG2_OFFSET 8
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG3_OFFSET 12
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG4_OFFSET 16
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG5_OFFSET 20
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG6_OFFSET 24
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG7_OFFSET 28
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG8_OFFSET 32
+#define MYIP_AXIS_MAP_S00_AXI_SLV_REG9_OFFSET 36
+
+/* 변환 표: 0x8000 부터 축마다 4096 항목 (항목 주소 = 축 x 4096 + 12비트 입력값)
+ * 워드 하나에 항목 2개 ([15:0] 짝수 입력값, [31:16] 홀수), 쓰기 전용 (읽으면 0, 확인은 PROBE)
+ * 항목 [15] 중립 구간 (네 축 모두 중립이면 입력 무시), [14:0] 펄스폭 0.1us 단위 (0 = 관절 그대로)
+ * 레지스터 맵: regmap.json 에서 생성 */
+#define MYIP_AXIS_MAP_LUT_OFFSET    0x8000
+#define MYIP_AXIS_MAP_LUT_AXIS_LEN  4096
+#define MYIP_AXIS_MAP_ENT_NEUTRAL   (1u << 15)
+#define MYIP_AXIS_MAP_ENT_PULSE     0x7FFFu     /* 0.1us 단위 */
+#define MYIP_AXIS_MAP_JOINTS        4
+#include "myip_axis_map_regs.h"
+
+
+/**************************** Type Definitions *****************************/
+/**
+ *
+ * Write a value to a MYIP_AXIS_MAP register. A 32 bit write is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is written.
+ *
+ * @param   BaseAddress is the base address of the MYIP_AXIS_MAPdevice.
+ * @param   RegOffset is the register offset from the base to write to.
+ * @param   Data is the data written to the register.
+ *
+ * @return  None.
+ *
+ * @note
+ * C-style signature:
+ * 	void MYIP_AXIS_MAP_mWriteReg(u32 BaseAddress, unsigned RegOffset, u32 Data)
+ *
+ */
+#define MYIP_AXIS_MAP_mWriteReg(BaseAddress, RegOffset, Data) \
+  	Xil_Out32((BaseAddress) + (RegOffset), (u32)(Data))
+
+/**
+ *
+ * Read a value from a MYIP_AXIS_MAP register. A 32 bit read is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is read from the register. The most significant data
+ * will be read as 0.
+ *
+ * @param   BaseAddress is the base address of the MYIP_AXIS_MAP device.
+ * @param   RegOffset is the register offset from the base to write to.
+ *
+ * @return  Data is the data from the register.
+ *
+ * @note
+ * C-style signature:
+ * 	u32 MYIP_AXIS_MAP_mReadReg(u32 BaseAddress, unsigned RegOffset)
+ *
+ */
+#define MYIP_AXIS_MAP_mReadReg(BaseAddress, RegOffset) \
+    Xil_In32((BaseAddress) + (RegOffset))
+
+/************************** Function Prototypes ****************************/
+/**
+ *
+ * Run a self-test on the driver/device. Note this may be a destructive test if
+ * resets of the device are performed.
+ *
+ * If the hardware system is not built correctly, this function may never
+ * return to the caller.
+ *
+ * @param   baseaddr_p is the base address of the MYIP_AXIS_MAP instance to be worked on.
+ *
+ * @return
+ *
+ *    - XST_SUCCESS   if all self-test code passed
+ *    - XST_FAILURE   if any self-test code failed
+ *
+ * @note    Caching must be turned off for this function to work.
+ * @note    Self test may fail if data memory and device are not on the same bus.
+ *
+ */
+XStatus MYIP_AXIS_MAP_Reg_SelfTest(void * baseaddr_p);
+
+#endif // MYIP_AXIS_MAP_H
@@ -0,0 +1,22 @@
+/* myip_axis_map 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_AXIS_MAP_REGS_H
+#define MYIP_AXIS_MAP_REGS_H
+
+#define MYIP_AXIS_MAP_CTRL_OFFSET            0x00    /* [3:0] 관절별 매핑 출력 사용 (0 = PWM DUTY 레지스터, 펌웨어), [4] 링크 프레임 축 입력 받음, [15:8] 받을 모드 (0 = 모두) */
+#define MYIP_AXIS_MAP_IN01_OFFSET            0x04    /* 펌웨어 축 입력 [11:0] 축0 (X1), [27:16] 축1 (Y1): IN23 쓸 때 같이 적용 */
+#define MYIP_AXIS_MAP_IN23_OFFSET            0x08    /* [11:0] 축2 (X2), [27:16] 축3 (Y2): 쓰면 IN01과 함께 표 변환 시작 */
+#define MYIP_AXIS_MAP_STATUS_OFFSET          0x0C    /* [0] 변환 중, [1] 마지막 입력이 전부 중립이라 건너뜀, [31:16] 적용한 입력 수 */
+#define MYIP_AXIS_MAP_AXES01_OFFSET          0x10    /* 마지막으로 변환한 축 입력 [11:0] 축0, [27:16] 축1 */
+#define MYIP_AXIS_MAP_AXES23_OFFSET          0x14    /* [11:0] 축2, [27:16] 축3 */
+#define MYIP_AXIS_MAP_PROBE_OFFSET           0x18    /* [13:0] 표 항목 주소 (축 x 4096 + 입력값): PROBE_OUT 으로 읽어 옴 */
+#define MYIP_AXIS_MAP_PROBE_OUT_OFFSET       0x1C    /* [15:0] PROBE 항목, [31] 읽기 완료 */
+#define MYIP_AXIS_MAP_OUT0_OFFSET            0x20    /* 관절 0 매핑 출력 (PWM high 클럭 수) */
+#define MYIP_AXIS_MAP_OUT1_OFFSET            0x24
+#define MYIP_AXIS_MAP_OUT2_OFFSET            0x28
+#define MYIP_AXIS_MAP_OUT3_OFFSET            0x2C
+#define MYIP_AXIS_MAP_CTRL_LINK_EN           (1u << 4)
+#define MYIP_AXIS_MAP_STATUS_BUSY            (1u << 0)
+#define MYIP_AXIS_MAP_STATUS_SKIPPED         (1u << 1)
+#define MYIP_AXIS_MAP_PROBE_OUT_VALID        (1u << 31)
+
+#endif
@@ -0,0 +1,107 @@
+`timescale 1 ns / 1 ps
+//////////////////////////////////////////////////////////////////////////////////
+// 공용 AXI4-Lite 슬레이브 인터페이스 (myip_* 공통)
+// 스톡 템플릿의 Waddr/Wdata/Raddr/Rdata 상태 머신 대신 매 클럭 쓰기 1개 + 읽기 1개를 받음
+//  - 쓰기: AW와 W가 둘 다 valid이고 B 슬롯이 비어 있으면 (또는 이번 클럭에 비워지면) 수락
+//  - 읽기: R 슬롯이 비어 있으면 (또는 이번 클럭에 비워지면) AR 수락, 데이터는 다음 클럭에 등록 출력
+// 사용자 로직은 wr_en/wr_idx/wr_data/wr_strb 로 레지스터를 쓰고, rd_idx 로 rd_data 를 조합 mux
+// rd_en 은 읽기 주소를 받은 클럭 (읽으면 지워지는 레지스터는 이 펄스로 지움)
+// 원본: ip_repo/common/hdl/axil_slave_pipe.v → 각 IP hdl/ 로 복사 (common/regmap.py --sync)
+//////////////////////////////////////////////////////////////////////////////////
+
+	module axil_slave_pipe #
+	(
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		parameter integer C_S_AXI_ADDR_WIDTH	= 5
+	)
+	(
+		// 사용자 로직 쪽
+		output wire  wr_en,
+		output wire [C_S_AXI_ADDR_WIDTH-(C_S_AXI_DATA_WIDTH/32)-2 : 0] wr_idx,
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+		output wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+		output wire  rd_en,
+		output wire [C_S_AXI_ADDR_WIDTH-(C_S_AXI_DATA_WIDTH/32)-2 : 0] rd_idx,
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] rd_data,
+
+		// AXI4-Lite
+		input wire  S_AXI_ACLK,
+		input wire  S_AXI_ARESETN,
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		input wire [2 : 0] S_AXI_AWPROT,
+		input wire  S_AXI_AWVALID,
+		output wire  S_AXI_AWREADY,
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		input wire  S_AXI_WVALID,
+		output wire  S_AXI_WREADY,
+		output wire [1 : 0] S_AXI_BRESP,
+		output wire  S_AXI_BVALID,
+		input wire  S_AXI_BREADY,
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		input wire [2 : 0] S_AXI_ARPROT,
+		input wire  S_AXI_ARVALID,
+		output wire  S_AXI_ARREADY,
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		output wire [1 : 0] S_AXI_RRESP,
+		output wire  S_AXI_RVALID,
+		input wire  S_AXI_RREADY
+	);
+
+	// ADDR_LSB = 2 for 32 bits, 3 for 64 bits
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer IDX_W = C_S_AXI_ADDR_WIDTH - ADDR_LSB;
+
+	reg  	axi_bvalid;
+	reg  	axi_rvalid;
+	reg [C_S_AXI_DATA_WIDTH-1 : 0] 	axi_rdata;
+
+	// 응답 슬롯이 비었거나 이번 클럭에 나가면 새 전송을 받을 수 있음
+	wire b_free = ~axi_bvalid | S_AXI_BREADY;
+	wire r_free = ~axi_rvalid | S_AXI_RREADY;
+
+	assign wr_en	= S_AXI_AWVALID & S_AXI_WVALID & b_free & S_AXI_ARESETN;
+	assign wr_idx	= S_AXI_AWADDR[ADDR_LSB +: IDX_W];
+	assign wr_data	= S_AXI_WDATA;
+	assign wr_strb	= S_AXI_WSTRB;
+
+	assign rd_en	= S_AXI_ARVALID & r_free & S_AXI_ARESETN;
+	assign rd_idx	= S_AXI_ARADDR[ADDR_LSB +: IDX_W];
+
+	// AW와 W는 같은 클럭에 함께 수락 (한쪽만 먼저 와도 다른 쪽을 기다림)
+	assign S_AXI_AWREADY	= wr_en;
+	assign S_AXI_WREADY	= wr_en;
+	assign S_AXI_BRESP	= 2'b00;
+	assign S_AXI_BVALID	= axi_bvalid;
+	assign S_AXI_ARREADY	= r_free & S_AXI_ARESETN;
+	assign S_AXI_RDATA	= axi_rdata;
+	assign S_AXI_RRESP	= 2'b00;
+	assign S_AXI_RVALID	= axi_rvalid;
+
+	always @( posedge S_AXI_ACLK )
+	begin
+	  if ( S_AXI_ARESETN == 1'b0 )
+	    axi_bvalid <= 1'b0;
+	  else if ( wr_en )
+	    axi_bvalid <= 1'b1;
+	  else if ( S_AXI_BREADY )
+	    axi_bvalid <= 1'b0;
+	end
+
+	always @( posedge S_AXI_ACLK )
+	begin
+	  if ( S_AXI_ARESETN == 1'b0 )
+	    begin
+	      axi_rvalid <= 1'b0;
+	      axi_rdata <= 0;
+	    end
+	  else if ( rd_en )
+	    begin
+	      axi_rvalid <= 1'b1;
+	      axi_rdata <= rd_data;
+	    end
+	  else if ( S_AXI_RREADY )
+	    axi_rvalid <= 1'b0;
+	end
+
+	endmodule
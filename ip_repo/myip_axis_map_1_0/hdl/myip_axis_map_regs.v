@@ -0,0 +1,93 @@
+`timescale 1 ns / 1 ps
+// myip_axis_map 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [3:0] 관절별 매핑 출력 사용 (0 = PWM DUTY 레지스터, 펌웨어), [4] 링크 프레임 축 입력 받음, [15:8] 받을 모드 (0 = 모두)
+// 0x04 IN01       wp  펌웨어 축 입력 [11:0] 축0 (X1), [27:16] 축1 (Y1): IN23 쓸 때 같이 적용
+// 0x08 IN23       wp  [11:0] 축2 (X2), [27:16] 축3 (Y2): 쓰면 IN01과 함께 표 변환 시작
+// 0x0C STATUS     ro  [0] 변환 중, [1] 마지막 입력이 전부 중립이라 건너뜀, [31:16] 적용한 입력 수
+// 0x10 AXES01     ro  마지막으로 변환한 축 입력 [11:0] 축0, [27:16] 축1
+// 0x14 AXES23     ro  [11:0] 축2, [27:16] 축3
+// 0x18 PROBE      wp  [13:0] 표 항목 주소 (축 x 4096 + 입력값): PROBE_OUT 으로 읽어 옴
+// 0x1C PROBE_OUT  ro  [15:0] PROBE 항목, [31] 읽기 완료
+// 0x20 OUT0       ro  관절 0 매핑 출력 (PWM high 클럭 수)
+// 0x24 OUT1       ro
+// 0x28 OUT2       ro
+// 0x2C OUT3       ro
+
+module myip_axis_map_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [13 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [13 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output wire  in01_wr,
+	output wire  in23_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] status,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] axes01,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] axes23,
+	output wire  probe_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] probe_out,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] out0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] out1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] out2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] out3,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [13:0] IDX_CTRL = 0;
+	localparam [13:0] IDX_IN01 = 1;
+	localparam [13:0] IDX_IN23 = 2;
+	localparam [13:0] IDX_STATUS = 3;
+	localparam [13:0] IDX_AXES01 = 4;
+	localparam [13:0] IDX_AXES23 = 5;
+	localparam [13:0] IDX_PROBE = 6;
+	localparam [13:0] IDX_PROBE_OUT = 7;
+	localparam [13:0] IDX_OUT0 = 8;
+	localparam [13:0] IDX_OUT1 = 9;
+	localparam [13:0] IDX_OUT2 = 10;
+	localparam [13:0] IDX_OUT3 = 11;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign in01_wr = wr_en && (wr_idx == IDX_IN01);
+	assign in23_wr = wr_en && (wr_idx == IDX_IN23);
+	assign probe_wr = wr_en && (wr_idx == IDX_PROBE);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_STATUS: rd_data = status;
+	    IDX_AXES01: rd_data = axes01;
+	    IDX_AXES23: rd_data = axes23;
+	    IDX_PROBE_OUT: rd_data = probe_out;
+	    IDX_OUT0: rd_data = out0;
+	    IDX_OUT1: rd_data = out1;
+	    IDX_OUT2: rd_data = out2;
+	    IDX_OUT3: rd_data = out3;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
@@ -0,0 +1,206 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_axis_map_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+
+		parameter integer C_TICKS_PER_UNIT	= 10,	// 표 단위 0.1us 당 클럭 수
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 16
+	)
+	(
+		// Users to add ports here
+        input wire [63:0] link_axes,    // myip_frame_rx 축 프레임 X1, Y1, X2, Y2 (u16)
+        input wire [7:0] link_mode,
+        input wire link_valid,          // 축 프레임 1클럭 펄스
+        output wire [127:0] map_duty,   // 관절 n = [n*32 +: 32], PWM high 클럭 수 (myip_pwm_multi 로)
+        output wire [3:0] map_sel,      // 1인 관절은 PWM이 DUTY 레지스터 대신 map_duty 사용
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 13;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+	wire [C_S_AXI_DATA_WIDTH-1:0] wr_data;
+	wire [(C_S_AXI_DATA_WIDTH/8)-1:0] wr_strb;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(wr_data),
+		.wr_strb(wr_strb),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// 레지스터 파일 (regmap.json → common/regmap.py 로 생성)
+	// 0x8000~0xFFFF: 변환 표 (쓰기 전용, 워드 = 항목 2개). 확인은 PROBE 로
+	wire [C_S_AXI_DATA_WIDTH-1:0] ctrl;
+	wire in01_wr, in23_wr, probe_wr;
+	reg [27:0] in01;
+	wire [15:0] upd_cnt;
+	wire [47:0] axes_last;
+	wire [15:0] probe_data;
+	wire probe_valid, skipped, busy;
+	wire [127:0] out;
+	wire [3:0] out_set;
+
+	myip_axis_map_regs # (
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH)
+	) regs (
+		.clk(S_AXI_ACLK),
+		.resetn(S_AXI_ARESETN),
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(wr_data),
+		.wr_strb(wr_strb),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.ctrl(ctrl),
+		.in01_wr(in01_wr),
+		.in23_wr(in23_wr),
+		.status({upd_cnt, 14'd0, skipped, busy}),
+		.axes01({4'd0, axes_last[23:12], 4'd0, axes_last[11:0]}),
+		.axes23({4'd0, axes_last[47:36], 4'd0, axes_last[35:24]}),
+		.probe_wr(probe_wr),
+		.probe_out({probe_valid, 15'd0, probe_data}),
+		.out0(out[31:0]),
+		.out1(out[63:32]),
+		.out2(out[95:64]),
+		.out3(out[127:96]),
+		.rd_data(rd_data)
+	);
+
+	// Add user logic here
+    // 링크 축 값은 u16이지만 조종기 ADC는 12비트: 넘는 값이 있으면 프레임을 버림 (펌웨어 process_frame 과 같음)
+    wire link_range = (link_axes[15:12] | link_axes[31:28] | link_axes[47:44] | link_axes[63:60]) == 0;
+    wire link_take = link_valid && link_range && ctrl[4] && (ctrl[15:8] == 0 || ctrl[15:8] == link_mode);
+    wire fw_take = in23_wr;
+    wire [47:0] fw_axes = {S_AXI_WDATA[27:16], S_AXI_WDATA[11:0], in01[27:16], in01[11:0]};
+    wire [47:0] link_axes12 = {link_axes[59:48], link_axes[43:32], link_axes[27:16], link_axes[11:0]};
+
+    always @(posedge S_AXI_ACLK) begin
+        if (S_AXI_ARESETN == 1'b0) in01 <= 0;
+        else if (in01_wr) in01 <= S_AXI_WDATA[27:0];
+    end
+
+    // 같은 클럭이면 펌웨어 입력 우선 (링크 축은 다음 프레임에 다시 옴)
+    axis_map_core #(.TICKS_PER_UNIT(C_TICKS_PER_UNIT)) core(
+        .clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN),
+        .lut_we(wr_en && wr_idx[13]), .lut_waddr(wr_idx[12:0]), .lut_wdata(wr_data), .lut_wstrb(wr_strb),
+        .start(fw_take || link_take), .axes_in(fw_take ? fw_axes : link_axes12),
+        .probe(probe_wr), .probe_addr(S_AXI_WDATA[13:0]),
+        .probe_data(probe_data), .probe_valid(probe_valid),
+        .out(out), .out_set(out_set), .axes_last(axes_last),
+        .skipped(skipped), .upd_cnt(upd_cnt), .busy(busy));
+
+    // 값이 한 번도 안 나온 관절은 계속 DUTY 레지스터로 (펄스 0으로 서보를 놓지 않게)
+    assign map_duty = out;
+    assign map_sel = ctrl[3:0] & out_set;
+	// User logic ends
+
+	endmodule
@@ -0,0 +1,162 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 조이스틱 축 → 서보 펄스폭 변환 (축마다 4096칸 표, BRAM 하나에 4축)
+// 표 항목 16비트: [15] 중립 구간, [14:0] 펄스폭 (0.1us 단위, 0 = 이 관절은 그대로 둠)
+// 네 축이 모두 중립 구간이면 입력 전체를 건너뜀 (펌웨어 작업 모드 중립 체크와 같음)
+// BRAM 워드 하나 = 항목 2개 ([15:0] 짝수 입력값, [31:16] 홀수)
+//////////////////////////////////////////////////////////////////////////////////
+
+module axis_map_core #(
+    parameter TICKS_PER_UNIT = 10            // 0.1us 당 클럭 수 (100MHz)
+)(
+    input clk,
+    input reset_p,
+    // 표 쓰기 (AXI)
+    input lut_we,
+    input [12:0] lut_waddr,
+    input [31:0] lut_wdata,
+    input [3:0] lut_wstrb,
+    // 축 입력: [11:0] 축0 ... [47:36] 축3
+    input start,
+    input [47:0] axes_in,
+    // 표 항목 하나 읽어 보기
+    input probe,
+    input [13:0] probe_addr,
+    output reg [15:0] probe_data,
+    output reg probe_valid,
+    output reg [127:0] out,                  // 관절 n = out[n*32 +: 32], PWM high 클럭 수
+    output reg [3:0] out_set,                // 한 번이라도 값이 나간 관절
+    output reg [47:0] axes_last,
+    output reg skipped,
+    output reg [15:0] upd_cnt,
+    output busy
+);
+
+    localparam S_IDLE  = 2'd0;
+    localparam S_READ  = 2'd1;
+    localparam S_EVAL  = 2'd2;
+    localparam S_PROBE = 2'd3;
+
+    (* ram_style = "block" *) reg [31:0] lut [0:8191];
+    reg [31:0] lut_q;
+
+    reg [1:0] state;
+    reg [2:0] k;                             // 읽기 요청 중인 축 (4 = 마지막 항목 대기)
+    reg [47:0] cur;
+    reg [47:0] pend_axes;
+    reg pend;
+    reg probe_pend, probe_cap, probe_half;
+    reg [13:0] probe_a;
+    reg cap_en, cap_half;
+    reg [1:0] cap_k;
+    reg [15:0] ent [0:3];
+
+    wire [11:0] cur_v = cur[k[1:0]*12 +: 12];
+    wire [12:0] raddr = (state == S_PROBE) ? probe_a[13:1] : {k[1:0], cur_v[11:1]};
+
+    assign busy = (state != S_IDLE) || pend;
+
+    // 단순 듀얼 포트: AXI 쓰기 + 변환 읽기
+    integer b;
+    always @(posedge clk) begin
+        if (lut_we) begin
+            for (b = 0; b < 4; b = b + 1)
+                if (lut_wstrb[b]) lut[lut_waddr][b*8 +: 8] <= lut_wdata[b*8 +: 8];
+        end
+        lut_q <= lut[raddr];
+    end
+
+    integer i;
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            state <= S_IDLE;
+            k <= 0;
+            cur <= 0;
+            pend_axes <= 0;
+            pend <= 0;
+            probe_pend <= 0;
+            probe_cap <= 0;
+            probe_half <= 0;
+            probe_a <= 0;
+            probe_data <= 0;
+            probe_valid <= 0;
+            cap_en <= 0;
+            cap_half <= 0;
+            cap_k <= 0;
+            out <= 0;
+            out_set <= 0;
+            axes_last <= 0;
+            skipped <= 0;
+            upd_cnt <= 0;
+            for (i = 0; i < 4; i = i + 1) ent[i] <= 0;
+        end
+        else begin
+            cap_en <= 0;
+            probe_cap <= 0;
+
+            // 변환 중에 온 입력은 최신 값 하나만 남김
+            if (start) begin
+                pend <= 1;
+                pend_axes <= axes_in;
+            end
+            if (probe) begin
+                probe_pend <= 1;
+                probe_a <= probe_addr;
+                probe_valid <= 0;
+            end
+
+            // 한 클럭 전에 요청한 항목
+            if (cap_en) ent[cap_k] <= cap_half ? lut_q[31:16] : lut_q[15:0];
+            if (probe_cap) begin
+                probe_data <= probe_half ? lut_q[31:16] : lut_q[15:0];
+                probe_valid <= 1;
+            end
+
+            case (state)
+                S_IDLE: begin
+                    if (pend && !start) begin
+                        pend <= 0;
+                        cur <= pend_axes;
+                        k <= 0;
+                        state <= S_READ;
+                    end
+                    else if (probe_pend && !probe) begin
+                        probe_pend <= 0;
+                        state <= S_PROBE;
+                    end
+                end
+
+                S_READ: begin
+                    if (k < 4) begin
+                        cap_en <= 1;
+                        cap_k <= k[1:0];
+                        cap_half <= cur_v[0];
+                    end
+                    k <= k + 1;
+                    if (k == 4) state <= S_EVAL;     // 마지막 항목이 ent에 들어갈 때까지 한 클럭
+                end
+
+                S_EVAL: begin
+                    skipped <= ent[0][15] & ent[1][15] & ent[2][15] & ent[3][15];
+                    if (!(ent[0][15] & ent[1][15] & ent[2][15] & ent[3][15])) begin
+                        for (i = 0; i < 4; i = i + 1)
+                            if (ent[i][14:0] != 0) begin
+                                out[i*32 +: 32] <= ent[i][14:0] * TICKS_PER_UNIT;
+                                out_set[i] <= 1;
+                            end
+                    end
+                    axes_last <= cur;
+                    upd_cnt <= upd_cnt + 1;
+                    state <= S_IDLE;
+                end
+
+                S_PROBE: begin
+                    probe_cap <= 1;
+                    probe_half <= probe_a[0];
+                    state <= S_IDLE;
+                end
+            endcase
+        end
+    end
+
+endmodule
@@ -16,6 +16,14 @@
 #define MYIP_BTN_S00_AXI_SLV_REG6_OFFSET 24
 #define MYIP_BTN_S00_AXI_SLV_REG7_OFFSET 28
 
+/* User register map */
+#define MYIP_BTN_PEDGE_OFFSET   MYIP_BTN_S00_AXI_SLV_REG0_OFFSET /* rising edge events, clear on read */
+#define MYIP_BTN_NEDGE_OFFSET   MYIP_BTN_S00_AXI_SLV_REG1_OFFSET /* falling edge events, clear on read */
+#define MYIP_BTN_LEVEL_OFFSET   MYIP_BTN_S00_AXI_SLV_REG2_OFFSET /* raw button level */
+#define MYIP_BTN_IRQ_EN_OFFSET  MYIP_BTN_S00_AXI_SLV_REG3_OFFSET /* [3:0] pedge, [7:4] nedge interrupt enable */
+#define MYIP_BTN_IRQ_EN_PEDGE(mask) ((u32)(mask) & 0xF)
+#define MYIP_BTN_IRQ_EN_NEDGE(mask) (((u32)(mask) & 0xF) << 4)
+
 
 /**************************** Type Definitions *****************************/
 /**
@@ -16,6 +16,7 @@
 	(
 		// Users to add ports here
  input [3:0]btn,
+ output btn_intr,
 		// User ports ends
 		// Do not modify the ports beyond this line
 
@@ -81,17 +82,6 @@
 		input wire  S_AXI_RREADY
 	);
 
-	// AXI4LITE signals
-	reg [C_S_AXI_ADDR_WIDTH-1 : 0] 	axi_awaddr;
-	reg  	axi_awready;
-	reg  	axi_wready;
-	reg [1 : 0] 	axi_bresp;
-	reg  	axi_bvalid;
-	reg [C_S_AXI_ADDR_WIDTH-1 : 0] 	axi_araddr;
-	reg  	axi_arready;
-	reg [1 : 0] 	axi_rresp;
-	reg  	axi_rvalid;
-
 	// Example-specific design signals
 	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
 	// ADDR_LSB is used for addressing 32/64 bit registers/memories
@@ -113,96 +103,51 @@
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg7;
 	integer	 byte_index;
 
-	// I/O Connections assignments
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
 
-	assign S_AXI_AWREADY	= axi_awready;
-	assign S_AXI_WREADY	= axi_wready;
-	assign S_AXI_BRESP	= axi_bresp;
-	assign S_AXI_BVALID	= axi_bvalid;
-	assign S_AXI_ARREADY	= axi_arready;
-	assign S_AXI_RRESP	= axi_rresp;
-	assign S_AXI_RVALID	= axi_rvalid;
-	 //state machine varibles 
-	 reg [1:0] state_write;
-	 reg [1:0] state_read;
-	 //State machine local parameters
-	 localparam Idle = 2'b00,Raddr = 2'b10,Rdata = 2'b11 ,Waddr = 2'b10,Wdata = 2'b11;
-	// Implement Write state machine
-	// Outstanding write transactions are not supported by the slave i.e., master should assert bready to receive response on or before it starts sending the new transaction
-	always @(posedge S_AXI_ACLK)                                 
-	  begin                                 
-	     if (S_AXI_ARESETN == 1'b0)                                 
-	       begin                                 
-	         axi_awready <= 0;                                 
-	         axi_wready <= 0;                                 
-	         axi_bvalid <= 0;                                 
-	         axi_bresp <= 0;                                 
-	         axi_awaddr <= 0;                                 
-	         state_write <= Idle;                                 
-	       end                                 
-	     else                                  
-	       begin                                 
-	         case(state_write)                                 
-	           Idle:                                      
-	             begin                                 
-	               if(S_AXI_ARESETN == 1'b1)                                  
-	                 begin                                 
-	                   axi_awready <= 1'b1;                                 
-	                   axi_wready <= 1'b1;                                 
-	                   state_write <= Waddr;                                 
-	                 end                                 
-	               else state_write <= state_write;                                 
-	             end                                 
-	           Waddr:        //At this state, slave is ready to receive address along with corresponding control signals and first data packet. Response valid is also handled at this state                                 
-	             begin                                 
-	               if (S_AXI_AWVALID && S_AXI_AWREADY)                                 
-	                  begin                                 
-	                    axi_awaddr <= S_AXI_AWADDR;                                 
-	                    if(S_AXI_WVALID)                                  
-	                      begin                                   
-	                        axi_awready <= 1'b1;                                 
-	                        state_write <= Waddr;                                 
-	                        axi_bvalid <= 1'b1;                                 
-	                      end                                 
-	                    else                                  
-	                      begin                                 
-	                        axi_awready <= 1'b0;                                 
-	                        state_write <= Wdata;                                 
-	                        if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                      end                                 
-	                  end                                 
-	               else                                  
-	                  begin                                 
-	                    state_write <= state_write;                                 
-	                    if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                   end                                 
-	             end                                 
-	          Wdata:        //At this state, slave is ready to receive the data packets until the number of transfers is equal to burst length                                 
-	             begin                                 
-	               if (S_AXI_WVALID)                                 
-	                 begin                                 
-	                   state_write <= Waddr;                                 
-	                   axi_bvalid <= 1'b1;                                 
-	                   axi_awready <= 1'b1;                                 
-	                 end                                 
-	                else                                  
-	                 begin                                 
-	                   state_write <= state_write;                                 
-	                   if (S_AXI_BREADY && axi_bvalid) axi_bvalid <= 1'b0;                                 
-	                 end                                              
-	             end                                 
-	          endcase                                 
-	        end                                 
-	      end                                 
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
 
 	// Implement memory mapped register select and write logic generation
-	// The write data is accepted and written to memory mapped registers when
-	// axi_awready, S_AXI_WVALID, axi_wready and S_AXI_WVALID are asserted. Write strobes are used to
-	// select byte enables of slave registers while writing.
-	// These registers are cleared when reset (active low) is applied.
-	// Slave register write enable is asserted when valid address and data are available
-	// and the slave is ready to accept the write address and write data.
+	// wr_en: AW/W를 수락한 클럭, wr_idx: 그때의 레지스터 번호
 	 wire [3:0] btn_pedge, btn_nedge;
+	 reg [3:0] pedge_evt, nedge_evt;
 
 	always @( posedge S_AXI_ACLK )
 	begin
@@ -218,9 +163,9 @@
 	      slv_reg7 <= 0;
 	    end 
 	  else begin
-	    if (S_AXI_WVALID)
+	    if (wr_en)
 	      begin
-	        case ( (S_AXI_AWVALID) ? S_AXI_AWADDR[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] : axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+	        case ( wr_idx )
 	          3'h0:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
@@ -292,63 +237,16 @@
 	  end
 	end    
 
-	// Implement read state machine
-	  always @(posedge S_AXI_ACLK)                                       
-	    begin                                       
-	      if (S_AXI_ARESETN == 1'b0)                                       
-	        begin                                       
-	         //asserting initial values to all 0's during reset                                       
-	         axi_arready <= 1'b0;                                       
-	         axi_rvalid <= 1'b0;                                       
-	         axi_rresp <= 1'b0;                                       
-	         state_read <= Idle;                                       
-	        end                                       
-	      else                                       
-	        begin                                       
-	          case(state_read)                                       
-	            Idle:     //Initial state inidicating reset is done and ready to receive read/write transactions                                       
-	              begin                                                
-	                if (S_AXI_ARESETN == 1'b1)                                        
-	                  begin                                       
-	                    state_read <= Raddr;                                       
-	                    axi_arready <= 1'b1;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	            Raddr:        //At this state, slave is ready to receive address along with corresponding control signals                                       
-	              begin                                       
-	                if (S_AXI_ARVALID && S_AXI_ARREADY)                                       
-	                  begin                                       
-	                    state_read <= Rdata;                                       
-	                    axi_araddr <= S_AXI_ARADDR;                                       
-	                    axi_rvalid <= 1'b1;                                       
-	                    axi_arready <= 1'b0;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	            Rdata:        //At this state, slave is ready to send the data packets until the number of transfers is equal to burst length                                       
-	              begin                                           
-	                if (S_AXI_RVALID && S_AXI_RREADY)                                       
-	                  begin                                       
-	                    axi_rvalid <= 1'b0;                                       
-	                    axi_arready <= 1'b1;                                       
-	                    state_read <= Raddr;                                       
-	                  end                                       
-	                else state_read <= state_read;                                       
-	              end                                       
-	           endcase                                       
-	          end                                       
-	        end                                         
 	// Implement memory mapped register select and read logic generation
-	  assign S_AXI_RDATA = 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h0) ? {28'd0, btn_pedge} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h1) ? {28'd0, btn_nedge} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h2) ? {28'd0, btn} : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h3) ? slv_reg3 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h4) ? slv_reg4 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h5) ? slv_reg5 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h6) ? slv_reg6 : 
-	  (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 3'h7) ? slv_reg7 : 0; 
+	  assign rd_data = 
+	  (rd_idx == 3'h0) ? {28'd0, pedge_evt} : 
+	  (rd_idx == 3'h1) ? {28'd0, nedge_evt} : 
+	  (rd_idx == 3'h2) ? {28'd0, btn} : 
+	  (rd_idx == 3'h3) ? slv_reg3 : 
+	  (rd_idx == 3'h4) ? slv_reg4 : 
+	  (rd_idx == 3'h5) ? slv_reg5 : 
+	  (rd_idx == 3'h6) ? slv_reg6 : 
+	  (rd_idx == 3'h7) ? slv_reg7 : 0; 
 	// Add user logic here
 	
 btn_cntr_vec inst(
@@ -358,6 +256,27 @@ btn_cntr_vec inst(
      .btn_pedge(btn_pedge), 
      .btn_nedge(btn_nedge)
 );
+
+// 엣지 이벤트 래치 (0x0: pedge, 0x4: nedge)
+// 한 번 발생하면 CPU가 해당 레지스터를 읽을 때까지 유지, 읽으면 클리어
+// 읽는 클럭에 새로 들어온 엣지는 잃지 않도록 OR
+wire rd_done = rd_en;    // 읽기 주소를 받은 클럭에 값이 RDATA로 잡히므로 그 클럭에 클리어
+wire rd_pedge = rd_done && (rd_idx == 3'h0);
+wire rd_nedge = rd_done && (rd_idx == 3'h1);
+
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        pedge_evt <= 4'd0;
+        nedge_evt <= 4'd0;
+    end
+    else begin
+        pedge_evt <= (rd_pedge ? 4'd0 : pedge_evt) | btn_pedge;
+        nedge_evt <= (rd_nedge ? 4'd0 : nedge_evt) | btn_nedge;
+    end
+end
+
+// 인터럽트 (레벨): slv_reg3[3:0] pedge 허용, slv_reg3[7:4] nedge 허용
+assign btn_intr = (|(pedge_evt & slv_reg3[3:0])) | (|(nedge_evt & slv_reg3[7:4]));
 	// User logic ends
 
 	endmodule
@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_encoder.h"
+
+/************************** Function Definitions ***************************/
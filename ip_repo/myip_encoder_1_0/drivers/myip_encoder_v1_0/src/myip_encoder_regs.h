@@ -0,0 +1,25 @@
+/* myip_encoder 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_ENCODER_REGS_H
+#define MYIP_ENCODER_REGS_H
+
+#define MYIP_ENCODER_CTRL_OFFSET             0x00    /* [0] 동작, [15:8] 글리치 필터 클럭, [19:16] 채널별 방향 반전 */
+#define MYIP_ENCODER_LATCH_OFFSET            0x04    /* 쓰면 전 채널 위치/주기 + 타임스탬프를 같은 클럭에 스냅샷 */
+#define MYIP_ENCODER_TIMEOUT_OFFSET          0x08    /* 이 클럭 동안 카운트가 없으면 정지 (주기 0) */
+#define MYIP_ENCODER_STAMP_OFFSET            0x0C    /* 스냅샷 시각 (클럭 카운터) */
+#define MYIP_ENCODER_CLEAR_OFFSET            0x10    /* [3:0] 1인 채널 위치를 0으로 */
+#define MYIP_ENCODER_INFO_OFFSET             0x14    /* [7:0] 채널 수 */
+#define MYIP_ENCODER_POS0_OFFSET             0x20    /* 스냅샷 위치 (4체배 카운트, 부호 있음) */
+#define MYIP_ENCODER_POS1_OFFSET             0x24
+#define MYIP_ENCODER_POS2_OFFSET             0x28
+#define MYIP_ENCODER_POS3_OFFSET             0x2C
+#define MYIP_ENCODER_PERIOD0_OFFSET          0x30    /* 스냅샷 카운트 간격 클럭 (부호 = 방향, 0 = 정지) */
+#define MYIP_ENCODER_PERIOD1_OFFSET          0x34
+#define MYIP_ENCODER_PERIOD2_OFFSET          0x38
+#define MYIP_ENCODER_PERIOD3_OFFSET          0x3C
+#define MYIP_ENCODER_ERR0_OFFSET             0x40    /* A/B가 동시에 바뀐 횟수 (누락된 카운트) */
+#define MYIP_ENCODER_ERR1_OFFSET             0x44
+#define MYIP_ENCODER_ERR2_OFFSET             0x48
+#define MYIP_ENCODER_ERR3_OFFSET             0x4C
+#define MYIP_ENCODER_CTRL_ENABLE             (1u << 0)
+
+#endif
@@ -0,0 +1,119 @@
+`timescale 1 ns / 1 ps
+// myip_encoder 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 동작, [15:8] 글리치 필터 클럭, [19:16] 채널별 방향 반전
+// 0x04 LATCH      wp  쓰면 전 채널 위치/주기 + 타임스탬프를 같은 클럭에 스냅샷
+// 0x08 TIMEOUT    rw  이 클럭 동안 카운트가 없으면 정지 (주기 0)
+// 0x0C STAMP      ro  스냅샷 시각 (클럭 카운터)
+// 0x10 CLEAR      wp  [3:0] 1인 채널 위치를 0으로
+// 0x14 INFO       ro  [7:0] 채널 수
+// 0x20 POS0       ro  스냅샷 위치 (4체배 카운트, 부호 있음)
+// 0x24 POS1       ro
+// 0x28 POS2       ro
+// 0x2C POS3       ro
+// 0x30 PERIOD0    ro  스냅샷 카운트 간격 클럭 (부호 = 방향, 0 = 정지)
+// 0x34 PERIOD1    ro
+// 0x38 PERIOD2    ro
+// 0x3C PERIOD3    ro
+// 0x40 ERR0       ro  A/B가 동시에 바뀐 횟수 (누락된 카운트)
+// 0x44 ERR1       ro
+// 0x48 ERR2       ro
+// 0x4C ERR3       ro
+
+module myip_encoder_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [4 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [4 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output wire  latch_wr,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] timeout,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] stamp,
+	output wire  clear_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] info,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] pos0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] pos1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] pos2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] pos3,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] period0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] period1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] period2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] period3,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] err0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] err1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] err2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] err3,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [4:0] IDX_CTRL = 0;
+	localparam [4:0] IDX_LATCH = 1;
+	localparam [4:0] IDX_TIMEOUT = 2;
+	localparam [4:0] IDX_STAMP = 3;
+	localparam [4:0] IDX_CLEAR = 4;
+	localparam [4:0] IDX_INFO = 5;
+	localparam [4:0] IDX_POS0 = 8;
+	localparam [4:0] IDX_POS1 = 9;
+	localparam [4:0] IDX_POS2 = 10;
+	localparam [4:0] IDX_POS3 = 11;
+	localparam [4:0] IDX_PERIOD0 = 12;
+	localparam [4:0] IDX_PERIOD1 = 13;
+	localparam [4:0] IDX_PERIOD2 = 14;
+	localparam [4:0] IDX_PERIOD3 = 15;
+	localparam [4:0] IDX_ERR0 = 16;
+	localparam [4:0] IDX_ERR1 = 17;
+	localparam [4:0] IDX_ERR2 = 18;
+	localparam [4:0] IDX_ERR3 = 19;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	      timeout <= 10000000;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_TIMEOUT: timeout[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign latch_wr = wr_en && (wr_idx == IDX_LATCH);
+	assign clear_wr = wr_en && (wr_idx == IDX_CLEAR);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_TIMEOUT: rd_data = timeout;
+	    IDX_STAMP: rd_data = stamp;
+	    IDX_INFO: rd_data = info;
+	    IDX_POS0: rd_data = pos0;
+	    IDX_POS1: rd_data = pos1;
+	    IDX_POS2: rd_data = pos2;
+	    IDX_POS3: rd_data = pos3;
+	    IDX_PERIOD0: rd_data = period0;
+	    IDX_PERIOD1: rd_data = period1;
+	    IDX_PERIOD2: rd_data = period2;
+	    IDX_PERIOD3: rd_data = period3;
+	    IDX_ERR0: rd_data = err0;
+	    IDX_ERR1: rd_data = err1;
+	    IDX_ERR2: rd_data = err2;
+	    IDX_ERR3: rd_data = err3;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
@@ -0,0 +1,221 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_encoder_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+		parameter integer C_NUM_CHANNELS	= 2,     // 엔코더 채널 수 (1~4)
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 7
+	)
+	(
+		// Users to add ports here
+        input wire [C_NUM_CHANNELS-1:0] enc_a,   // 엔코더 A상 [0] 왼쪽, [1] 오른쪽
+        input wire [C_NUM_CHANNELS-1:0] enc_b,   // 엔코더 B상
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 4;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// 레지스터 파일 (regmap.json → common/regmap.py 로 생성)
+	wire [C_S_AXI_DATA_WIDTH-1:0] ctrl, timeout;
+	wire latch_wr, clear_wr;
+	reg  [C_S_AXI_DATA_WIDTH-1:0] stamp;
+	reg  [31:0] pos_snap [0:3];
+	reg  [31:0] period_snap [0:3];
+	wire [31:0] pos_live [0:3];
+	wire [31:0] period_live [0:3];
+	wire [15:0] err_live [0:3];
+
+	myip_encoder_regs # (
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH)
+	) regs (
+		.clk(S_AXI_ACLK),
+		.resetn(S_AXI_ARESETN),
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(S_AXI_WDATA),
+		.wr_strb(S_AXI_WSTRB),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.ctrl(ctrl),
+		.latch_wr(latch_wr),
+		.timeout(timeout),
+		.stamp(stamp),
+		.clear_wr(clear_wr),
+		.info(C_NUM_CHANNELS),
+		.pos0(pos_snap[0]),
+		.pos1(pos_snap[1]),
+		.pos2(pos_snap[2]),
+		.pos3(pos_snap[3]),
+		.period0(period_snap[0]),
+		.period1(period_snap[1]),
+		.period2(period_snap[2]),
+		.period3(period_snap[3]),
+		.err0({16'd0, err_live[0]}),
+		.err1({16'd0, err_live[1]}),
+		.err2({16'd0, err_live[2]}),
+		.err3({16'd0, err_live[3]}),
+		.rd_data(rd_data)
+	);
+
+	// Add user logic here
+    // 채널별 디코더 (없는 채널은 0)
+    genvar n;
+    generate
+        for (n = 0; n < 4; n = n + 1) begin : ch
+            if (n < C_NUM_CHANNELS) begin : used
+                quad_decoder dec(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]),
+                    .a_in(enc_a[n]), .b_in(enc_b[n]), .filt(ctrl[15:8]), .invert(ctrl[16 + n]),
+                    .clear(clear_wr && S_AXI_WDATA[n]), .timeout(timeout),
+                    .position(pos_live[n]), .period_est(period_live[n]), .errors(err_live[n]));
+            end
+            else begin : none
+                assign pos_live[n] = 0;
+                assign period_live[n] = 0;
+                assign err_live[n] = 0;
+            end
+        end
+    endgenerate
+
+    // LATCH 쓰기: 모든 채널을 같은 클럭에 스냅샷 (두 바퀴 값을 따로 읽어도 서로 맞음)
+    reg [31:0] clk_cnt;
+    integer i;
+
+    always @(posedge S_AXI_ACLK) begin
+        if (S_AXI_ARESETN == 1'b0) begin
+            clk_cnt <= 0;
+            stamp <= 0;
+            for (i = 0; i < 4; i = i + 1) begin
+                pos_snap[i] <= 0;
+                period_snap[i] <= 0;
+            end
+        end
+        else begin
+            clk_cnt <= clk_cnt + 1;
+            if (latch_wr) begin
+                stamp <= clk_cnt;
+                for (i = 0; i < 4; i = i + 1) begin
+                    pos_snap[i] <= pos_live[i];
+                    period_snap[i] <= period_live[i];
+                end
+            end
+        end
+    end
+	// User logic ends
+
+	endmodule
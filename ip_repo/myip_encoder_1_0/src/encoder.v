@@ -0,0 +1,106 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 직교(quadrature) 바퀴 엔코더 한 채널
+// 동기화 + 글리치 필터 + 4체배 디코드 + 32비트 위치
+// 카운트 사이 클럭을 하드웨어로 재서 저속에서도 펌웨어 미분 없이 속도를 얻음
+//////////////////////////////////////////////////////////////////////////////////
+
+module quad_decoder(
+    input clk,
+    input reset_p,
+    input enable,
+    input a_in,
+    input b_in,
+    input [7:0] filt,            // 입력이 filt 클럭 동안 그대로여야 인정 (0이면 필터 없음)
+    input invert,                // 1: 방향 반전 (반대쪽에 달린 바퀴용)
+    input clear,                 // 위치를 0으로
+    input [31:0] timeout,        // 이 클럭 동안 카운트가 없으면 정지로 봄
+    output reg [31:0] position,
+    output [31:0] period_est,    // 카운트 간격 클럭 (부호 = 방향, 0 = 정지)
+    output reg [15:0] errors     // A/B 동시 변화 (카운트 누락) 횟수
+);
+
+    // 2단 동기화
+    reg [1:0] a_sync, b_sync;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            a_sync <= 0;
+            b_sync <= 0;
+        end
+        else begin
+            a_sync <= {a_sync[0], a_in};
+            b_sync <= {b_sync[0], b_in};
+        end
+    end
+
+    // 글리치 필터: 바뀐 값이 filt 클럭 유지돼야 반영
+    reg a_f, b_f;
+    reg [7:0] a_cnt, b_cnt;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            a_f <= 0; a_cnt <= 0;
+            b_f <= 0; b_cnt <= 0;
+        end
+        else begin
+            if (a_sync[1] == a_f) a_cnt <= 0;
+            else if (a_cnt >= filt) begin a_f <= a_sync[1]; a_cnt <= 0; end
+            else a_cnt <= a_cnt + 1;
+
+            if (b_sync[1] == b_f) b_cnt <= 0;
+            else if (b_cnt >= filt) begin b_f <= b_sync[1]; b_cnt <= 0; end
+            else b_cnt <= b_cnt + 1;
+        end
+    end
+
+    // 4체배 디코드: A/B 중 하나만 바뀌면 카운트, 둘 다 바뀌면 오류
+    reg a_d, b_d;
+    wire a_chg = a_f ^ a_d;
+    wire b_chg = b_f ^ b_d;
+    wire step = enable && (a_chg ^ b_chg);
+    wire illegal = enable && a_chg && b_chg;
+    wire fwd = (a_f ^ b_d) ^ invert;     // A가 앞서면 전진
+
+    // 속도: 마지막 카운트 이후 클럭(age)과 직전 카운트 간격(period)
+    reg [31:0] age;
+    reg signed [31:0] period;
+    wire stopped = (age >= timeout);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            a_d <= 0;
+            b_d <= 0;
+            position <= 0;
+            errors <= 0;
+            age <= 32'hFFFFFFFF;
+            period <= 0;
+        end
+        else begin
+            a_d <= a_f;
+            b_d <= b_f;
+
+            if (clear) position <= 0;
+            else if (step) position <= fwd ? position + 1 : position - 1;
+
+            if (illegal && errors != 16'hFFFF) errors <= errors + 1;
+
+            if (step) begin
+                // 정지 후 첫 카운트는 간격을 알 수 없으므로 0 유지
+                if (stopped) period <= 0;
+                else period <= fwd ? $signed(age + 1) : -$signed(age + 1);
+                age <= 0;
+            end
+            else begin
+                if (age != 32'hFFFFFFFF) age <= age + 1;
+                if (stopped) period <= 0;
+            end
+        end
+    end
+
+    // 감속 중에는 마지막 간격보다 현재 경과 시간이 길어짐: 둘 중 큰 값을 써서 속도가 바로 떨어지게
+    wire [31:0] mag = period[31] ? -period : period;
+    wire [31:0] est = (age > mag) ? age : mag;
+    assign period_est = (period == 0) ? 0 : (period[31] ? -est : est);
+
+endmodule
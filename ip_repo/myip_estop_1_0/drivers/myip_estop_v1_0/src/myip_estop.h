@@ -0,0 +1,97 @@
+
+#ifndef MYIP_ESTOP_H
+#define MYIP_ESTOP_H
+
+
+/****************** Include Files ********************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define MYIP_ESTOP_S00_AXI_SLV_REG0_OFFSET 0
+#define MYIP_ESTOP_S00_AXI_SLV_REG1_OFFSET 4
+#define MYIP_ESTOP_S00_AXI_SLV_REG2_OFFSET 8
+#define MYIP_ESTOP_S00_AXI_SLV_REG3_OFFSET 12
+#define MYIP_ESTOP_S00_AXI_SLV_REG4_OFFSET 16
+#define MYIP_ESTOP_S00_AXI_SLV_REG5_OFFSET 20
+#define MYIP_ESTOP_S00_AXI_SLV_REG6_OFFSET 24
+#define MYIP_ESTOP_S00_AXI_SLV_REG7_OFFSET 28
+#define MYIP_ESTOP_S00_AXI_SLV_REG8_OFFSET 32
+#define MYIP_ESTOP_S00_AXI_SLV_REG9_OFFSET 36
+
+/* RX 선에서 PAT1:PAT0 의 끝 LEN 바이트와 같은 바이트열이 보이면 (또는 trip_in 펄스) 비상정지
+ * 걸리면 estop 출력이 1 로 유지되어 myip_handle/myip_hbridge 방향 출력과 myip_pwm_multi 바퀴 채널을 끔
+ * 해제는 CLEAR 쓰기로만 (펌웨어가 모터 목표를 0으로 만든 뒤)
+ * 최악 지연: 마지막 바이트 정지 비트 시작부터 반 비트 + 송신 보드레이트 오차 누적 + 몇 클럭
+ *   (38400bps, 오차 ±2%: 20us 이내, sim/run_sim.sh 로 측정)
+ * 레지스터 맵: regmap.json 에서 생성 */
+#define MYIP_ESTOP_PAT_MAX          8
+#define MYIP_ESTOP_TEXT_PAT0        0x4E3D3136u     /* "BTN=16" 끝 4바이트 (리셋값) */
+#define MYIP_ESTOP_TEXT_PAT1        0x00004254u
+#define MYIP_ESTOP_TEXT_LEN         6
+#include "myip_estop_regs.h"
+
+
+/**************************** Type Definitions *****************************/
+/**
+ *
+ * Write a value to a MYIP_ESTOP register. A 32 bit write is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is written.
+ *
+ * @param   BaseAddress is the base address of the MYIP_ESTOPdevice.
+ * @param   RegOffset is the register offset from the base to write to.
+ * @param   Data is the data written to the register.
+ *
+ * @return  None.
+ *
+ * @note
+ * C-style signature:
+ * 	void MYIP_ESTOP_mWriteReg(u32 BaseAddress, unsigned RegOffset, u32 Data)
+ *
+ */
+#define MYIP_ESTOP_mWriteReg(BaseAddress, RegOffset, Data) \
+  	Xil_Out32((BaseAddress) + (RegOffset), (u32)(Data))
+
+/**
+ *
+ * Read a value from a MYIP_ESTOP register. A 32 bit read is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is read from the register. The most significant data
+ * will be read as 0.
+ *
+ * @param   BaseAddress is the base address of the MYIP_ESTOP device.
+ * @param   RegOffset is the register offset from the base to write to.
+ *
+ * @return  Data is the data from the register.
+ *
+ * @note
+ * C-style signature:
+ * 	u32 MYIP_ESTOP_mReadReg(u32 BaseAddress, unsigned RegOffset)
+ *
+ */
+#define MYIP_ESTOP_mReadReg(BaseAddress, RegOffset) \
+    Xil_In32((BaseAddress) + (RegOffset))
+
+/************************** Function Prototypes ****************************/
+/**
+ *
+ * Run a self-test on the driver/device. Note this may be a destructive test if
+ * resets of the device are performed.
+ *
+ * If the hardware system is not built correctly, this function may never
+ * return to the caller.
+ *
+ * @param   baseaddr_p is the base address of the MYIP_ESTOP instance to be worked on.
+ *
+ * @return
+ *
+ *    - XST_SUCCESS   if all self-test code passed
+ *    - XST_FAILURE   if any self-test code failed
+ *
+ * @note    Caching must be turned off for this function to work.
+ * @note    Self test may fail if data memory and device are not on the same bus.
+ *
+ */
+XStatus MYIP_ESTOP_Reg_SelfTest(void * baseaddr_p);
+
+#endif // MYIP_ESTOP_H
@@ -0,0 +1,21 @@
+/* myip_estop 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_ESTOP_REGS_H
+#define MYIP_ESTOP_REGS_H
+
+#define MYIP_ESTOP_CTRL_OFFSET               0x00    /* [0] 감시 동작, [1] 비상정지 인터럽트, [2] trip_in (프레임 수신기) 사용. 리셋 직후부터 감시 */
+#define MYIP_ESTOP_BAUD_OFFSET               0x04    /* 16배 오버샘플 분주 = 클럭 / (16 x baud) (100MHz: 163=38400) */
+#define MYIP_ESTOP_PAT0_OFFSET               0x08    /* 비상정지 바이트열 끝 4바이트 ([7:0] = 마지막 바이트). 기본 "BTN=16" */
+#define MYIP_ESTOP_PAT1_OFFSET               0x0C    /* 그 앞 4바이트 ([7:0] = 끝에서 5번째) */
+#define MYIP_ESTOP_LEN_OFFSET                0x10    /* [3:0] 바이트열 길이 1~8 (0 = 바이트열 감시 끔) */
+#define MYIP_ESTOP_STATUS_OFFSET             0x14    /* [0] 비상정지 걸림 (CLEAR 쓸 때까지 유지, 바퀴 출력 차단), [1] 바이트열로 걸림, [2] trip_in 으로 걸림 */
+#define MYIP_ESTOP_CLEAR_OFFSET              0x18    /* 1 쓰면 비상정지 해제 (같은 클럭에 다시 걸리면 걸림 유지) */
+#define MYIP_ESTOP_TRIPS_OFFSET              0x1C    /* [15:0] 비상정지 걸린 횟수 */
+#define MYIP_ESTOP_AGE_OFFSET                0x20    /* 걸린 뒤 지난 클럭 수 (포화, 펌웨어 반응 시간 확인용) */
+#define MYIP_ESTOP_CTRL_ENABLE               (1u << 0)
+#define MYIP_ESTOP_CTRL_IRQ_EN               (1u << 1)
+#define MYIP_ESTOP_CTRL_TRIP_IN_EN           (1u << 2)
+#define MYIP_ESTOP_STATUS_TRIPPED            (1u << 0)
+#define MYIP_ESTOP_STATUS_BY_PATTERN         (1u << 1)
+#define MYIP_ESTOP_STATUS_BY_TRIP_IN         (1u << 2)
+
+#endif
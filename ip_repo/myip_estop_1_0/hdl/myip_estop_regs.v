@@ -0,0 +1,89 @@
+`timescale 1 ns / 1 ps
+// myip_estop 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 감시 동작, [1] 비상정지 인터럽트, [2] trip_in (프레임 수신기) 사용. 리셋 직후부터 감시
+// 0x04 BAUD       rw  16배 오버샘플 분주 = 클럭 / (16 x baud) (100MHz: 163=38400)
+// 0x08 PAT0       rw  비상정지 바이트열 끝 4바이트 ([7:0] = 마지막 바이트). 기본 "BTN=16"
+// 0x0C PAT1       rw  그 앞 4바이트 ([7:0] = 끝에서 5번째)
+// 0x10 LEN        rw  [3:0] 바이트열 길이 1~8 (0 = 바이트열 감시 끔)
+// 0x14 STATUS     ro  [0] 비상정지 걸림 (CLEAR 쓸 때까지 유지, 바퀴 출력 차단), [1] 바이트열로 걸림, [2] trip_in 으로 걸림
+// 0x18 CLEAR      wp  1 쓰면 비상정지 해제 (같은 클럭에 다시 걸리면 걸림 유지)
+// 0x1C TRIPS      ro  [15:0] 비상정지 걸린 횟수
+// 0x20 AGE        ro  걸린 뒤 지난 클럭 수 (포화, 펌웨어 반응 시간 확인용)
+
+module myip_estop_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [3 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [3 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] baud,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] pat0,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] pat1,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] len,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] status,
+	output wire  clear_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] trips,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] age,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [3:0] IDX_CTRL = 0;
+	localparam [3:0] IDX_BAUD = 1;
+	localparam [3:0] IDX_PAT0 = 2;
+	localparam [3:0] IDX_PAT1 = 3;
+	localparam [3:0] IDX_LEN = 4;
+	localparam [3:0] IDX_STATUS = 5;
+	localparam [3:0] IDX_CLEAR = 6;
+	localparam [3:0] IDX_TRIPS = 7;
+	localparam [3:0] IDX_AGE = 8;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 5;
+	      baud <= 163;
+	      pat0 <= 1312633142;
+	      pat1 <= 16980;
+	      len <= 6;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_BAUD: baud[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PAT0: pat0[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PAT1: pat1[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_LEN: len[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign clear_wr = wr_en && (wr_idx == IDX_CLEAR);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_BAUD: rd_data = baud;
+	    IDX_PAT0: rd_data = pat0;
+	    IDX_PAT1: rd_data = pat1;
+	    IDX_LEN: rd_data = len;
+	    IDX_STATUS: rd_data = status;
+	    IDX_TRIPS: rd_data = trips;
+	    IDX_AGE: rd_data = age;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
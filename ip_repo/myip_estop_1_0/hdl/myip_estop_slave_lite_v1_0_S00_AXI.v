@@ -0,0 +1,206 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_estop_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 6
+	)
+	(
+		// Users to add ports here
+        input wire uart_rx,         // HC-05 TXD (UART Lite RX와 같은 핀을 같이 받음)
+        input wire trip_in,         // 외부 비상정지 펄스 (myip_frame_rx 의 비상정지 버튼 프레임)
+        output wire estop,          // 걸림 유지 중 1: 바퀴 구동 출력 차단
+        output wire estop_intr,
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 3;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// 레지스터 파일 (regmap.json → common/regmap.py 로 생성)
+	wire [C_S_AXI_DATA_WIDTH-1:0] ctrl, baud, pat0, pat1, len;
+	wire clear_wr;
+	reg tripped, by_pattern, by_trip_in;
+	reg [15:0] trips;
+	reg [31:0] age;
+
+	wire [7:0] rx_data;
+	wire rx_valid, rx_ferr, pat_match;
+
+	myip_estop_regs # (
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH)
+	) regs (
+		.clk(S_AXI_ACLK),
+		.resetn(S_AXI_ARESETN),
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(S_AXI_WDATA),
+		.wr_strb(S_AXI_WSTRB),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.ctrl(ctrl),
+		.baud(baud),
+		.pat0(pat0),
+		.pat1(pat1),
+		.len(len),
+		.status({29'd0, by_trip_in, by_pattern, tripped}),
+		.clear_wr(clear_wr),
+		.trips({16'd0, trips}),
+		.age(age),
+		.rd_data(rd_data)
+	);
+
+	// Add user logic here
+    uart_rx_os16 rx(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]), .div(baud[15:0]),
+        .rx_in(uart_rx), .data(rx_data), .valid(rx_valid), .ferr(rx_ferr));
+
+    estop_sniffer sniff(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]),
+        .rx_data(rx_data), .rx_valid(rx_valid), .rx_ferr(rx_ferr),
+        .pattern({pat1, pat0}), .len(len[3:0]), .match(pat_match));
+
+    wire trip_pat = ctrl[0] && pat_match;
+    wire trip_ext = ctrl[0] && ctrl[2] && trip_in;
+
+    always @(posedge S_AXI_ACLK) begin
+        if (S_AXI_ARESETN == 1'b0) begin
+            tripped <= 0;
+            by_pattern <= 0;
+            by_trip_in <= 0;
+            trips <= 0;
+            age <= 0;
+        end
+        else begin
+            // CLEAR와 같은 클럭에 다시 걸리면 걸림이 이김
+            tripped <= (clear_wr ? 1'b0 : tripped) | trip_pat | trip_ext;
+            by_pattern <= (clear_wr ? 1'b0 : by_pattern) | trip_pat;
+            by_trip_in <= (clear_wr ? 1'b0 : by_trip_in) | trip_ext;
+            if ((trip_pat || trip_ext) && (!tripped || clear_wr)) begin
+                trips <= trips + 1;
+                age <= 0;
+            end
+            else if (tripped && age != 32'hFFFFFFFF) age <= age + 1;
+        end
+    end
+
+    // 다른 IP로 가는 차단 신호는 레지스터 출력 (글리치 없음)
+    assign estop = tripped;
+    assign estop_intr = tripped && ctrl[1];
+	// User logic ends
+
+	endmodule
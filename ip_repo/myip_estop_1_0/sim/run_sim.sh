@@ -0,0 +1,18 @@
+#!/bin/sh
+# myip_estop Verilator 테스트벤치 실행 (일반 리눅스 + verilator 5.x / 4.2xx)
+#   ./run_sim.sh
+# 비상정지 바이트열 → estop 출력 최악 지연을 보드레이트 오차/바이트 위상 스윕으로 측정
+# AXI 마스터 모델은 ip_repo/sim 공통 헤더 사용
+set -e
+cd "$(dirname "$0")"
+
+COMMON=../../sim
+
+verilator --cc --exe --build -j 0 -O3 -Wno-fatal -Wno-lint -Wno-style \
+    --top-module myip_estop -CFLAGS "-O2 -I$(pwd)/$COMMON" \
+    ../hdl/myip_estop.v ../hdl/myip_estop_slave_lite_v1_0_S00_AXI.v ../hdl/myip_estop_regs.v \
+    ../hdl/axil_slave_pipe.v ../src/estop.v \
+    tb_myip_estop.cpp -o tb_myip_estop
+
+./obj_dir/tb_myip_estop | tee sim.log
+grep -q '^PASS' sim.log
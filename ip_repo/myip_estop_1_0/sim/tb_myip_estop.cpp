@@ -0,0 +1,311 @@
+// myip_estop Verilator 테스트벤치
+// RX 선 모델로 실제 링크처럼 바이트를 흘려 보내면서
+//  1) 평소 텍스트 줄 / 이진 프레임에서는 절대 안 걸림
+//  2) 비상정지 바이트열이 오면 걸리고, 마지막 바이트 정지 비트 시작부터 estop 출력까지의 지연을
+//     보드레이트 오차 ±2% x 바이트 위상 여러 개로 재서 최악값이 한도 안인지
+//  3) 걸림 유지 / CLEAR / 프레이밍 오류로 끊긴 바이트열 / trip_in / 감시 끔
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include "verilated.h"
+#include "Vmyip_estop.h"
+#include "axi_lite_master.h"
+
+#define REG_CTRL        0x00
+#define REG_BAUD        0x04
+#define REG_PAT0        0x08
+#define REG_PAT1        0x0C
+#define REG_LEN         0x10
+#define REG_STATUS      0x14
+#define REG_CLEAR       0x18
+#define REG_TRIPS       0x1C
+#define REG_AGE         0x20
+
+#define CLK_HZ          100000000.0
+#define BAUD            38400.0
+#define DIV             163             // 리셋값 (100MHz / 16 / 38400)
+#define BAUD_ERR        0.02            // 송신 측 보드레이트 오차 스윕 범위
+#define LATENCY_SLACK   8               // 동기화 2 + 수신 1 + 비교 1 + 걸림 1 + 여유
+
+// 한도: 정지 비트 가운데까지 반 비트 + 송신 오차가 9.5비트 동안 쌓인 것 + 오버샘플 틱 1개 + 몇 클럭
+static const uint64_t LATENCY_BOUND =
+    (uint64_t)(CLK_HZ / BAUD * (0.5 + 9.5 * BAUD_ERR)) + DIV + LATENCY_SLACK;
+
+// 8N1 송신 모델: 매 클럭 step() 하면 level 이 RX 선 값
+struct UartLine {
+    double bit_clk = CLK_HZ / BAUD;     // 비트당 클럭 (송신 측 보드레이트 오차 포함)
+    std::deque<uint16_t> q;             // [7:0] 바이트, [8] 지연 측정 표시, [9] 정지 비트를 0으로 (프레이밍 오류)
+    uint64_t gap = 0;                   // 다음 바이트 전에 쉴 클럭
+    uint64_t mark_stop = 0;             // 표시한 바이트의 정지 비트 시작 클럭
+    int level = 1;
+
+    void put(uint8_t b, unsigned flags = 0) { q.push_back(b | flags); }
+    void put(const std::string &s) { for (char c : s) put((uint8_t)c); }
+    bool idle() const { return !busy_ && q.empty() && gap == 0; }
+
+    void step(uint64_t now) {
+        if (!busy_) {
+            if (gap) { gap--; level = 1; return; }
+            if (q.empty()) { level = 1; return; }
+            cur_ = q.front();
+            q.pop_front();
+            busy_ = true;
+            t_ = 0;
+        }
+        int bit = (int)(t_ / bit_clk);
+        if (bit == 0) level = 0;
+        else if (bit <= 8) level = (cur_ >> (bit - 1)) & 1;
+        else if (bit == 9) {
+            if ((int)((t_ - 1) / bit_clk) != 9 && (cur_ & 0x100)) mark_stop = now;
+            level = (cur_ & 0x200) ? 0 : 1;
+        }
+        else {
+            busy_ = false;
+            level = 1;
+        }
+        t_ += 1;
+    }
+
+private:
+    bool busy_ = false;
+    uint16_t cur_ = 0;
+    double t_ = 0;
+};
+
+static Vmyip_estop *top;
+static AxiLiteMaster<Vmyip_estop> *bus;
+static UartLine line;
+static uint64_t estop_rise;             // 마지막 estop 상승 클럭 (0 = 없음)
+static int fails, checks;
+static uint32_t rng = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    rng = rng * 1103515245u + 12345u;
+    return (rng >> 8) % n;
+}
+
+static void check(bool ok, const char *what) {
+    checks++;
+    if (!ok) {
+        fails++;
+        std::printf("FAIL %s (cycle %llu)\n", what, (unsigned long long)bus->cycles);
+    }
+}
+
+static void drain() {
+    while (!line.idle()) bus->tick();
+    bus->run((uint64_t)(line.bit_clk * 2));     // 마지막 바이트 수신 + 걸림까지
+}
+
+static void clear_trip() {
+    bus->write(REG_CLEAR, 1);
+    estop_rise = 0;
+}
+
+static std::string joystick_line() {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "MODE=%u X1=%04u Y1=%04u X2=%04u Y2=%04u\n",
+        1 + rnd(2), rnd(4096), rnd(4096), rnd(4096), rnd(4096));
+    return buf;
+}
+
+static uint16_t crc16(const uint8_t *p, int len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)*p++ << 8;
+        for (int k = 0; k < 8; k++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// 조종기 이진 프레임 (link_tx_build 와 같은 형식, 값은 범위 안에서 무작위)
+static void put_frame() {
+    static uint8_t seq;
+    uint8_t f[16];
+    f[0] = 0xA5;
+    f[1] = 0x5A;
+    f[2] = seq++;
+    f[3] = rnd(3);
+    f[4] = rnd(2) ? 0 : (1u << rnd(5));
+    f[5] = rnd(4);
+    for (int i = 0; i < 4; i++) {
+        uint16_t v = rnd(4096);
+        f[6 + i * 2] = v & 0xFF;
+        f[7 + i * 2] = v >> 8;
+    }
+    uint16_t crc = crc16(f + 2, 12);
+    f[14] = crc >> 8;
+    f[15] = crc & 0xFF;
+    for (uint8_t b : f) line.put(b);
+}
+
+// 평소 링크 내용으로는 안 걸림
+static void no_false_trip_text() {
+    for (int i = 0; i < 150; i++) {
+        switch (rnd(8)) {
+        case 0: { char b[32]; std::snprintf(b, sizeof b, "BTN=%02u MODE=%u\n", 1u << rnd(4), 1 + rnd(2)); line.put(b); break; }
+        case 1: line.put("MODE=1 NEUTRAL=1\n"); break;
+        case 2: line.put("BTN=1"); line.put('6', 0x200); line.put(" MODE=1\n"); break;  // 끝 바이트가 깨짐
+        case 3: line.put("BTN=01 MODE=16\n"); break;
+        default: line.put(joystick_line()); break;
+        }
+        line.gap = rnd((uint32_t)line.bit_clk * 3);
+        drain();
+    }
+    check(estop_rise == 0 && top->estop == 0, "text stream tripped without BTN=16");
+}
+
+// 비상정지 바이트열 → estop 까지 지연 (정지 비트 시작 기준)
+static uint64_t measure_trip(const std::string &pat) {
+    line.put(joystick_line());
+    line.gap = rnd((uint32_t)line.bit_clk);
+    for (size_t i = 0; i < pat.size(); i++) line.put((uint8_t)pat[i], i + 1 == pat.size() ? 0x100 : 0);
+    line.put(" MODE=1\n");
+    drain();
+    checks++;
+    if (!estop_rise || estop_rise < line.mark_stop) {
+        fails++;
+        std::printf("FAIL no trip for pattern (err %.3f)\n", line.bit_clk * BAUD / CLK_HZ - 1);
+        return 0;
+    }
+    return estop_rise - line.mark_stop;
+}
+
+static void latency_sweep() {
+    static const double errs[] = { -BAUD_ERR, -BAUD_ERR / 2, 0.0, BAUD_ERR / 2, BAUD_ERR };
+    uint64_t worst = 0, best = ~0ull;
+
+    for (double e : errs) {
+        line.bit_clk = CLK_HZ / (BAUD * (1 + e));
+        for (int k = 0; k < 24; k++) {
+            uint64_t lat = measure_trip("BTN=16");
+            if (lat > worst) worst = lat;
+            if (lat < best) best = lat;
+
+            // 걸린 채로 다른 바이트가 와도 유지, CLEAR 로만 해제
+            check(top->estop == 1, "estop dropped before CLEAR");
+            uint32_t st = bus->read(REG_STATUS);
+            check((st & 0x3) == 0x3, "STATUS tripped/by_pattern not set");
+            clear_trip();
+            bus->run(4);
+            check(top->estop == 0 && (bus->read(REG_STATUS) & 1) == 0, "CLEAR did not release");
+        }
+    }
+    line.bit_clk = CLK_HZ / BAUD;
+
+    std::printf("stop latency: best %llu, worst %llu clk (%.2f us), bound %llu clk (%.2f us), bit %.0f clk\n",
+        (unsigned long long)best, (unsigned long long)worst, worst / CLK_HZ * 1e6,
+        (unsigned long long)LATENCY_BOUND, LATENCY_BOUND / CLK_HZ * 1e6, CLK_HZ / BAUD);
+    check(worst <= LATENCY_BOUND, "worst-case stop latency over bound");
+    check(bus->read(REG_TRIPS) == 5 * 24, "TRIPS count");
+}
+
+// 이진 프레임 링크용 예약 바이트열 (프레임 안에서는 0xE5 가 세 번 연달아 나올 수 없음)
+static void binary_pattern() {
+    bus->write(REG_PAT0, 0x00E5E5E5);
+    bus->write(REG_PAT1, 0);
+    bus->write(REG_LEN, 3);
+    for (int i = 0; i < 300; i++) {
+        put_frame();
+        if (rnd(3) == 0) line.gap = rnd((uint32_t)line.bit_clk * 4);
+        if (i % 30 == 29) drain();
+    }
+    drain();
+    check(estop_rise == 0, "binary frames tripped E5 E5 E5 pattern");
+
+    uint64_t lat = measure_trip("\xE5\xE5\xE5");
+    check(lat && lat <= LATENCY_BOUND, "binary pattern latency");
+    clear_trip();
+
+    // 바이트열 중간의 프레이밍 오류는 이어 붙지 않음
+    line.put(0xE5);
+    line.put(0xE5);
+    line.put(0x00, 0x200);
+    line.put(0xE5);
+    drain();
+    check(estop_rise == 0, "pattern across framing error tripped");
+
+    bus->write(REG_PAT0, 0x4E3D3136);
+    bus->write(REG_PAT1, 0x00004254);
+    bus->write(REG_LEN, 6);
+}
+
+static void trip_input_and_enable() {
+    // trip_in: CTRL[2] 켜졌을 때만
+    bus->write(REG_CTRL, 0x1);
+    top->trip_in = 1;
+    bus->tick();
+    top->trip_in = 0;
+    bus->run(4);
+    check(top->estop == 0, "trip_in tripped with CTRL[2]=0");
+
+    bus->write(REG_CTRL, 0x5);
+    top->trip_in = 1;
+    bus->tick();
+    top->trip_in = 0;
+    bus->run(4);
+    check(top->estop == 1 && (bus->read(REG_STATUS) & 0x5) == 0x5, "trip_in did not trip");
+    uint32_t a0 = bus->read(REG_AGE);
+    bus->run(100);
+    check(bus->read(REG_AGE) > a0 + 100, "AGE not counting");
+    clear_trip();
+
+    // 인터럽트
+    bus->write(REG_CTRL, 0x7);
+    line.put("BTN=16\n");
+    drain();
+    check(top->estop_intr == 1, "estop_intr not raised");
+    clear_trip();
+    bus->run(2);
+    check(top->estop_intr == 0, "estop_intr not cleared");
+
+    // 감시 끔
+    bus->write(REG_CTRL, 0x0);
+    line.put("BTN=16\n");
+    drain();
+    check(top->estop == 0, "tripped while disabled");
+    bus->write(REG_CTRL, 0x5);
+}
+
+int main(int argc, char **argv) {
+    Verilated::commandArgs(argc, argv);
+    top = new Vmyip_estop;
+    bus = new AxiLiteMaster<Vmyip_estop>(top);
+    top->uart_rx = 1;
+    top->trip_in = 0;
+
+    int prev_estop = 0;
+    bus->on_cycle = [&] {
+        if (top->estop && !prev_estop) estop_rise = bus->cycles;
+        prev_estop = top->estop;
+        line.step(bus->cycles);
+        top->uart_rx = line.level;
+    };
+    bus->reset();
+
+    // 리셋 직후부터 텍스트 "BTN=16" 감시
+    check(bus->read(REG_CTRL) == 0x5, "CTRL reset value");
+    check(bus->read(REG_BAUD) == DIV, "BAUD reset value");
+    check(bus->read(REG_LEN) == 6, "LEN reset value");
+    check(bus->read(REG_STATUS) == 0, "STATUS after reset");
+
+    no_false_trip_text();
+    latency_sweep();
+    binary_pattern();
+    trip_input_and_enable();
+
+    std::printf("%llu cycles\n", (unsigned long long)bus->cycles);
+    top->final();
+    delete bus;
+    delete top;
+
+    if (fails) {
+        std::printf("FAILED %d of %d checks\n", fails, checks);
+        return 1;
+    }
+    std::printf("PASS %d checks\n", checks);
+    return 0;
+}
@@ -0,0 +1,134 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 비상정지 감시기 (HC-05 UART RX 선에 직접 연결, CPU와 무관하게 동작)
+// 최근 받은 바이트가 PAT 바이트열과 같으면 곧바로 걸림 → 바퀴 출력 차단 (myip_handle/hbridge/pwm_multi)
+// 걸림은 펌웨어가 CLEAR 쓸 때까지 유지
+//////////////////////////////////////////////////////////////////////////////////
+
+// 8N1 UART 수신 (16배 오버샘플, 비트 가운데에서 샘플)
+module uart_rx_os16(
+    input clk,
+    input reset_p,
+    input enable,
+    input [15:0] div,                // 오버샘플 틱당 클럭 수
+    input rx_in,
+    output reg [7:0] data,
+    output reg valid,                // 1클럭 펄스
+    output reg ferr                  // 정지 비트가 0 (1클럭 펄스)
+);
+
+    localparam S_IDLE  = 2'd0;
+    localparam S_START = 2'd1;
+    localparam S_DATA  = 2'd2;
+    localparam S_STOP  = 2'd3;
+
+    reg [1:0] rx_s;
+    reg [1:0] state;
+    reg [15:0] div_cnt;
+    reg [3:0] os_cnt;
+    reg [2:0] bit_idx;
+
+    wire rx = rx_s[1];
+    wire os_tick = (div_cnt + 1 >= div);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            rx_s <= 2'b11;
+            state <= S_IDLE;
+            div_cnt <= 0;
+            os_cnt <= 0;
+            bit_idx <= 0;
+            data <= 0;
+            valid <= 0;
+            ferr <= 0;
+        end
+        else begin
+            rx_s <= {rx_s[0], rx_in};
+            valid <= 0;
+            ferr <= 0;
+
+            // 시작 비트 하강 엣지에서 분주기를 맞춤
+            if (state == S_IDLE || os_tick) div_cnt <= 0;
+            else div_cnt <= div_cnt + 1;
+
+            case (state)
+                S_IDLE: begin
+                    os_cnt <= 0;
+                    if (enable && !rx) state <= S_START;
+                end
+
+                S_START: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 7) begin
+                        os_cnt <= 0;
+                        bit_idx <= 0;
+                        state <= rx ? S_IDLE : S_DATA;     // 가운데에서 1이면 글리치
+                    end
+                end
+
+                S_DATA: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 15) begin
+                        data <= {rx, data[7:1]};            // LSB 먼저
+                        bit_idx <= bit_idx + 1;
+                        if (bit_idx == 7) state <= S_STOP;
+                    end
+                end
+
+                S_STOP: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 15) begin
+                        valid <= rx;
+                        ferr <= !rx;
+                        state <= S_IDLE;
+                    end
+                end
+            endcase
+        end
+    end
+
+endmodule
+
+// 최근 바이트 8개를 밀어 넣으면서 끝 len 바이트를 바이트열과 비교
+module estop_sniffer(
+    input clk,
+    input reset_p,
+    input enable,
+    input [7:0] rx_data,
+    input rx_valid,
+    input rx_ferr,
+    input [63:0] pattern,            // [7:0] = 마지막 바이트
+    input [3:0] len,                 // 1~8 (0 = 끔)
+    output reg match                 // 1클럭 펄스 (마지막 바이트 정지 비트 다음 클럭)
+);
+
+    reg [63:0] hist;                 // [7:0] = 가장 최근 바이트
+    reg [3:0] fill;                  // 리셋/오류 뒤 받은 바이트 수 (8에서 멈춤)
+
+    wire [63:0] next_hist = {hist[55:0], rx_data};
+    wire [3:0] n = (len > 8) ? 4'd8 : len;
+    wire [63:0] mask = (n == 8) ? {64{1'b1}} : ((64'd1 << {n, 3'b000}) - 1);
+    wire hit = (n != 0) && (fill + 1 >= n) && ((next_hist & mask) == (pattern & mask));
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            hist <= 0;
+            fill <= 0;
+            match <= 0;
+        end
+        else begin
+            match <= 0;
+            if (!enable || rx_ferr) begin
+                // 깨진 바이트 앞뒤가 이어져 보이지 않게 비움
+                hist <= 0;
+                fill <= 0;
+            end
+            else if (rx_valid) begin
+                hist <= next_hist;
+                if (fill < 8) fill <= fill + 1;
+                match <= hit;
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_frame_rx.h"
+
+/************************** Function Definitions ***************************/
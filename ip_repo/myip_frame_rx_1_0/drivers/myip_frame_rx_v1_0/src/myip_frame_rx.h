@@ -0,0 +1,98 @@
+
+#ifndef MYIP_FRAME_RX_H
+#define MYIP_FRAME_RX_H
+
+
+/****************** Include Files ********************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG0_OFFSET 0
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG1_OFFSET 4
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG2_OFFSET 8
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG3_OFFSET 12
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG4_OFFSET 16
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG5_OFFSET 20
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG6_OFFSET 24
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG7_OFFSET 28
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG8_OFFSET 32
+#define MYIP_FRAME_RX_S00_AXI_SLV_REG9_OFFSET 36
+
+/* 조종기 링크 프레임: A5 5A | 페이로드 16바이트 | CRC16 상위, 하위 (CRC-16/CCITT-FALSE, 페이로드만)
+ * 페이로드 (FRAME0~3 에 리틀 엔디언으로 그대로 보임)
+ *   [0] 송신 번호 [1] 모드 [2] 버튼 비트 [3] 플래그 [4..11] X1, Y1, X2, Y2 (u16)
+ *   [12..15] 송신 시각 (u32 ms, 조종기 시계: 수신부 재생 버퍼가 씀)
+ * SEQ 를 읽으면 그때의 최신 프레임이 고정되고 FRAME0~3/STAMP 는 다음 SEQ 읽기까지 안 바뀜
+ * 레지스터 맵: regmap.json 에서 생성 */
+#define MYIP_FRAME_RX_SYNC0         0xA5
+#define MYIP_FRAME_RX_SYNC1         0x5A
+#define MYIP_FRAME_RX_PAYLOAD       16
+#define MYIP_FRAME_RX_FLAG_NEUTRAL  (1u << 0)   /* 중립 (모터 정지) */
+#define MYIP_FRAME_RX_FLAG_AXES     (1u << 1)   /* X1~Y2 유효 */
+#include "myip_frame_rx_regs.h"
+
+
+/**************************** Type Definitions *****************************/
+/**
+ *
+ * Write a value to a MYIP_FRAME_RX register. A 32 bit write is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is written.
+ *
+ * @param   BaseAddress is the base address of the MYIP_FRAME_RXdevice.
+ * @param   RegOffset is the register offset from the base to write to.
+ * @param   Data is the data written to the register.
+ *
+ * @return  None.
+ *
+ * @note
+ * C-style signature:
+ * 	void MYIP_FRAME_RX_mWriteReg(u32 BaseAddress, unsigned RegOffset, u32 Data)
+ *
+ */
+#define MYIP_FRAME_RX_mWriteReg(BaseAddress, RegOffset, Data) \
+  	Xil_Out32((BaseAddress) + (RegOffset), (u32)(Data))
+
+/**
+ *
+ * Read a value from a MYIP_FRAME_RX register. A 32 bit read is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is read from the register. The most significant data
+ * will be read as 0.
+ *
+ * @param   BaseAddress is the base address of the MYIP_FRAME_RX device.
+ * @param   RegOffset is the register offset from the base to write to.
+ *
+ * @return  Data is the data from the register.
+ *
+ * @note
+ * C-style signature:
+ * 	u32 MYIP_FRAME_RX_mReadReg(u32 BaseAddress, unsigned RegOffset)
+ *
+ */
+#define MYIP_FRAME_RX_mReadReg(BaseAddress, RegOffset) \
+    Xil_In32((BaseAddress) + (RegOffset))
+
+/************************** Function Prototypes ****************************/
+/**
+ *
+ * Run a self-test on the driver/device. Note this may be a destructive test if
+ * resets of the device are performed.
+ *
+ * If the hardware system is not built correctly, this function may never
+ * return to the caller.
+ *
+ * @param   baseaddr_p is the base address of the MYIP_FRAME_RX instance to be worked on.
+ *
+ * @return
+ *
+ *    - XST_SUCCESS   if all self-test code passed
+ *    - XST_FAILURE   if any self-test code failed
+ *
+ * @note    Caching must be turned off for this function to work.
+ * @note    Self test may fail if data memory and device are not on the same bus.
+ *
+ */
+XStatus MYIP_FRAME_RX_Reg_SelfTest(void * baseaddr_p);
+
+#endif // MYIP_FRAME_RX_H
@@ -0,0 +1,25 @@
+/* myip_frame_rx 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_FRAME_RX_REGS_H
+#define MYIP_FRAME_RX_REGS_H
+
+#define MYIP_FRAME_RX_CTRL_OFFSET            0x00    /* [0] 동작, [1] 새 프레임 인터럽트, [2] 오류 인터럽트 */
+#define MYIP_FRAME_RX_BAUD_OFFSET            0x04    /* 16배 오버샘플 분주 = 클럭 / (16 x baud) (100MHz: 163=38400, 651=9600) */
+#define MYIP_FRAME_RX_GAP_OFFSET             0x08    /* 프레임 중 바이트 간격이 이 클럭을 넘으면 버리고 동기부터 다시 (0 = 끔) */
+#define MYIP_FRAME_RX_IRQ_OFFSET             0x0C    /* [0] 새 프레임, [1] CRC/프레이밍/간격 오류 (읽으면 지움) */
+#define MYIP_FRAME_RX_STATUS_OFFSET          0x10    /* [0] 프레임 수신 중 (동기 찾음), [1] 읽기 뱅크, [2] 최신 뱅크 */
+#define MYIP_FRAME_RX_ERRS_OFFSET            0x14    /* [15:0] CRC 오류 수, [31:16] 프레이밍/간격 오류 수 */
+#define MYIP_FRAME_RX_SEQ_OFFSET             0x18    /* 읽으면 최신 프레임을 읽기 뱅크로 고정 (다음 SEQ 읽기까지 안 바뀜). [15:0] 그 프레임의 수신 번호 (0 = 아직 없음) */
+#define MYIP_FRAME_RX_STAMP_OFFSET           0x1C    /* 읽기 뱅크 프레임의 CRC 확인 시각 (클럭 카운터) */
+#define MYIP_FRAME_RX_FRAME0_OFFSET          0x20    /* 읽기 뱅크 페이로드 바이트 0~3 (리틀 엔디언) */
+#define MYIP_FRAME_RX_FRAME1_OFFSET          0x24    /* 페이로드 바이트 4~7 */
+#define MYIP_FRAME_RX_FRAME2_OFFSET          0x28    /* 페이로드 바이트 8~11 */
+#define MYIP_FRAME_RX_NOW_OFFSET             0x2C    /* 현재 클럭 카운터 (NOW - STAMP = 프레임 나이) */
+#define MYIP_FRAME_RX_FRAME3_OFFSET          0x30    /* 페이로드 바이트 12~15 (송신 시각) */
+#define MYIP_FRAME_RX_CTRL_ENABLE            (1u << 0)
+#define MYIP_FRAME_RX_CTRL_IRQ_FRAME         (1u << 1)
+#define MYIP_FRAME_RX_CTRL_IRQ_ERR           (1u << 2)
+#define MYIP_FRAME_RX_IRQ_FRAME              (1u << 0)
+#define MYIP_FRAME_RX_IRQ_ERR                (1u << 1)
+#define MYIP_FRAME_RX_STATUS_BUSY            (1u << 0)
+
+#endif
@@ -0,0 +1,105 @@
+`timescale 1 ns / 1 ps
+// myip_frame_rx 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 동작, [1] 새 프레임 인터럽트, [2] 오류 인터럽트
+// 0x04 BAUD       rw  16배 오버샘플 분주 = 클럭 / (16 x baud) (100MHz: 163=38400, 651=9600)
+// 0x08 GAP        rw  프레임 중 바이트 간격이 이 클럭을 넘으면 버리고 동기부터 다시 (0 = 끔)
+// 0x0C IRQ        rc  [0] 새 프레임, [1] CRC/프레이밍/간격 오류 (읽으면 지움)
+// 0x10 STATUS     ro  [0] 프레임 수신 중 (동기 찾음), [1] 읽기 뱅크, [2] 최신 뱅크
+// 0x14 ERRS       ro  [15:0] CRC 오류 수, [31:16] 프레이밍/간격 오류 수
+// 0x18 SEQ        rc  읽으면 최신 프레임을 읽기 뱅크로 고정 (다음 SEQ 읽기까지 안 바뀜). [15:0] 그 프레임의 수신 번호 (0 = 아직 없음)
+// 0x1C STAMP      ro  읽기 뱅크 프레임의 CRC 확인 시각 (클럭 카운터)
+// 0x20 FRAME0     ro  읽기 뱅크 페이로드 바이트 0~3 (리틀 엔디언)
+// 0x24 FRAME1     ro  페이로드 바이트 4~7
+// 0x28 FRAME2     ro  페이로드 바이트 8~11
+// 0x2C NOW        ro  현재 클럭 카운터 (NOW - STAMP = 프레임 나이)
+// 0x30 FRAME3     ro  페이로드 바이트 12~15 (송신 시각)
+
+module myip_frame_rx_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [3 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [3 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] baud,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] gap,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] irq,
+	output wire  irq_rd,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] status,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] errs,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] seq,
+	output wire  seq_rd,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] stamp,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] frame0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] frame1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] frame2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] now,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] frame3,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [3:0] IDX_CTRL = 0;
+	localparam [3:0] IDX_BAUD = 1;
+	localparam [3:0] IDX_GAP = 2;
+	localparam [3:0] IDX_IRQ = 3;
+	localparam [3:0] IDX_STATUS = 4;
+	localparam [3:0] IDX_ERRS = 5;
+	localparam [3:0] IDX_SEQ = 6;
+	localparam [3:0] IDX_STAMP = 7;
+	localparam [3:0] IDX_FRAME0 = 8;
+	localparam [3:0] IDX_FRAME1 = 9;
+	localparam [3:0] IDX_FRAME2 = 10;
+	localparam [3:0] IDX_NOW = 11;
+	localparam [3:0] IDX_FRAME3 = 12;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	      baud <= 163;
+	      gap <= 78125;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_BAUD: baud[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_GAP: gap[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign irq_rd = rd_en && (rd_idx == IDX_IRQ);
+	assign seq_rd = rd_en && (rd_idx == IDX_SEQ);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_BAUD: rd_data = baud;
+	    IDX_GAP: rd_data = gap;
+	    IDX_IRQ: rd_data = irq;
+	    IDX_STATUS: rd_data = status;
+	    IDX_ERRS: rd_data = errs;
+	    IDX_SEQ: rd_data = seq;
+	    IDX_STAMP: rd_data = stamp;
+	    IDX_FRAME0: rd_data = frame0;
+	    IDX_FRAME1: rd_data = frame1;
+	    IDX_FRAME2: rd_data = frame2;
+	    IDX_NOW: rd_data = now;
+	    IDX_FRAME3: rd_data = frame3;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
@@ -0,0 +1,248 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_frame_rx_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 6
+	)
+	(
+		// Users to add ports here
+        input wire uart_rx,         // HC-05 TXD (UART Lite RX와 같은 핀을 같이 받음)
+        output wire frame_rx_intr,  // 새 프레임 / 오류 (IRQ 레지스터를 읽으면 내려감)
+        output reg [63:0] axes_out,     // 마지막 축 프레임의 X1, Y1, X2, Y2 (u16, myip_axis_map 으로)
+        output reg [7:0] axes_mode,     // 그 프레임의 모드
+        output reg axes_valid,          // 축 프레임 (AXES 플래그, 버튼/중립 아님) CRC 통과 시 1클럭 펄스
+        output reg estop_frame,         // 비상정지 버튼 (BTN 비트 4) 프레임 CRC 통과 시 1클럭 펄스 (myip_estop trip_in)
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 3;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// 레지스터 파일 (regmap.json → common/regmap.py 로 생성)
+	localparam integer PAYLOAD = 16;    // 페이로드 바이트 (FRAME0~3)
+	wire [C_S_AXI_DATA_WIDTH-1:0] ctrl, baud, gap;
+	wire irq_rd, seq_rd;
+	reg [1:0] irq_flags;
+	reg [15:0] crc_errs, frame_errs;
+	reg [31:0] clk_cnt;
+
+	// 뱅크 2개: 읽기 뱅크(CPU가 SEQ로 고정)와 쓰기 뱅크. CRC가 맞은 프레임은 한 클럭에 통째로 씀
+	reg [PAYLOAD*8-1:0] bank_data [0:1];
+	reg [15:0] bank_seq [0:1];
+	reg [31:0] bank_stamp [0:1];
+	reg rd_bank, new_bank;
+	reg [15:0] frame_cnt;
+
+	wire [PAYLOAD*8-1:0] payload;
+	wire good, crc_err, frame_err, busy;
+	wire [7:0] rx_data;
+	wire rx_valid, rx_ferr;
+
+	myip_frame_rx_regs # (
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH)
+	) regs (
+		.clk(S_AXI_ACLK),
+		.resetn(S_AXI_ARESETN),
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(S_AXI_WDATA),
+		.wr_strb(S_AXI_WSTRB),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.ctrl(ctrl),
+		.baud(baud),
+		.gap(gap),
+		.irq({30'd0, irq_flags}),
+		.irq_rd(irq_rd),
+		.status({29'd0, new_bank, rd_bank, busy}),
+		.errs({frame_errs, crc_errs}),
+		.seq({16'd0, bank_seq[new_bank]}),     // 읽는 클럭에 고정될 뱅크의 번호
+		.seq_rd(seq_rd),
+		.stamp(bank_stamp[rd_bank]),
+		.frame0(bank_data[rd_bank][31:0]),
+		.frame1(bank_data[rd_bank][63:32]),
+		.frame2(bank_data[rd_bank][95:64]),
+		.frame3(bank_data[rd_bank][127:96]),
+		.now(clk_cnt),
+		.rd_data(rd_data)
+	);
+
+	// Add user logic here
+    uart_rx_os16 rx(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]), .div(baud[15:0]),
+        .rx_in(uart_rx), .data(rx_data), .valid(rx_valid), .ferr(rx_ferr));
+
+    frame_decoder #(.PAYLOAD(PAYLOAD)) dec(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]),
+        .rx_data(rx_data), .rx_valid(rx_valid), .rx_ferr(rx_ferr), .gap(gap),
+        .payload(payload), .good(good), .crc_err(crc_err), .frame_err(frame_err), .busy(busy));
+
+    wire axes_frame = good && payload[25] && !payload[24] && payload[23:16] == 0;   // AXES, 중립/버튼 아님
+
+    // SEQ 읽기와 새 프레임이 같은 클럭이면: 최신 뱅크를 고정하고 새 프레임은 다른 뱅크로
+    wire lock_bank = seq_rd ? new_bank : rd_bank;
+    wire wr_bank = !lock_bank;
+
+    always @(posedge S_AXI_ACLK) begin
+        if (S_AXI_ARESETN == 1'b0) begin
+            clk_cnt <= 0;
+            rd_bank <= 0;
+            new_bank <= 0;
+            frame_cnt <= 0;
+            bank_data[0] <= 0;
+            bank_data[1] <= 0;
+            bank_seq[0] <= 0;
+            bank_seq[1] <= 0;
+            bank_stamp[0] <= 0;
+            bank_stamp[1] <= 0;
+            crc_errs <= 0;
+            frame_errs <= 0;
+            irq_flags <= 0;
+            axes_out <= 0;
+            axes_mode <= 0;
+            axes_valid <= 0;
+            estop_frame <= 0;
+        end
+        else begin
+            clk_cnt <= clk_cnt + 1;
+            rd_bank <= lock_bank;
+            if (good) begin
+                bank_data[wr_bank] <= payload;
+                bank_seq[wr_bank] <= (frame_cnt == 16'hFFFF) ? 16'd1 : frame_cnt + 1;   // 0은 "아직 없음"
+                bank_stamp[wr_bank] <= clk_cnt;
+                frame_cnt <= (frame_cnt == 16'hFFFF) ? 16'd1 : frame_cnt + 1;
+                new_bank <= wr_bank;
+            end
+            // 축 값은 CPU를 거치지 않고 바로 매핑 IP로
+            axes_valid <= axes_frame;
+            estop_frame <= good && payload[20];
+            if (axes_frame) begin
+                axes_out <= payload[95:32];
+                axes_mode <= payload[15:8];
+            end
+            if (crc_err) crc_errs <= crc_errs + 1;
+            if (frame_err) frame_errs <= frame_errs + 1;
+            // 이벤트는 IRQ 레지스터를 읽을 때까지 유지 (같은 클럭에 새 이벤트가 오면 남김)
+            irq_flags <= (irq_rd ? 2'b00 : irq_flags) | {crc_err || frame_err, good};
+        end
+    end
+
+    assign frame_rx_intr = |(irq_flags & ctrl[2:1]);
+	// User logic ends
+
+	endmodule
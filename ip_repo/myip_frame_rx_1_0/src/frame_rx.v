@@ -0,0 +1,195 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 조종기 링크 프레임 수신기 (HC-05 UART RX 선에 직접 연결)
+// 프레임 20바이트: A5 5A | 페이로드 16바이트 | CRC16 상위, 하위
+//   CRC-16/CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF), 페이로드에 대해 계산
+//   페이로드 + CRC(상위 먼저)를 통째로 넣으면 나머지 0 → 맞는 프레임
+// 동기 바이트는 ASCII 밖이라 기존 텍스트 줄만 오면 프레임은 절대 잡히지 않음
+//////////////////////////////////////////////////////////////////////////////////
+
+// 8N1 UART 수신 (16배 오버샘플, 비트 가운데에서 샘플)
+module uart_rx_os16(
+    input clk,
+    input reset_p,
+    input enable,
+    input [15:0] div,                // 오버샘플 틱당 클럭 수
+    input rx_in,
+    output reg [7:0] data,
+    output reg valid,                // 1클럭 펄스
+    output reg ferr                  // 정지 비트가 0 (1클럭 펄스)
+);
+
+    localparam S_IDLE  = 2'd0;
+    localparam S_START = 2'd1;
+    localparam S_DATA  = 2'd2;
+    localparam S_STOP  = 2'd3;
+
+    reg [1:0] rx_s;
+    reg [1:0] state;
+    reg [15:0] div_cnt;
+    reg [3:0] os_cnt;
+    reg [2:0] bit_idx;
+
+    wire rx = rx_s[1];
+    wire os_tick = (div_cnt + 1 >= div);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            rx_s <= 2'b11;
+            state <= S_IDLE;
+            div_cnt <= 0;
+            os_cnt <= 0;
+            bit_idx <= 0;
+            data <= 0;
+            valid <= 0;
+            ferr <= 0;
+        end
+        else begin
+            rx_s <= {rx_s[0], rx_in};
+            valid <= 0;
+            ferr <= 0;
+
+            // 시작 비트 하강 엣지에서 분주기를 맞춤
+            if (state == S_IDLE || os_tick) div_cnt <= 0;
+            else div_cnt <= div_cnt + 1;
+
+            case (state)
+                S_IDLE: begin
+                    os_cnt <= 0;
+                    if (enable && !rx) state <= S_START;
+                end
+
+                S_START: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 7) begin
+                        os_cnt <= 0;
+                        bit_idx <= 0;
+                        state <= rx ? S_IDLE : S_DATA;     // 가운데에서 1이면 글리치
+                    end
+                end
+
+                S_DATA: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 15) begin
+                        data <= {rx, data[7:1]};            // LSB 먼저
+                        bit_idx <= bit_idx + 1;
+                        if (bit_idx == 7) state <= S_STOP;
+                    end
+                end
+
+                S_STOP: if (os_tick) begin
+                    os_cnt <= os_cnt + 1;
+                    if (os_cnt == 15) begin
+                        valid <= rx;
+                        ferr <= !rx;
+                        state <= S_IDLE;
+                    end
+                end
+            endcase
+        end
+    end
+
+endmodule
+
+// 바이트 흐름에서 동기 찾기 → 페이로드 모으기 → CRC 확인
+module frame_decoder #(
+    parameter PAYLOAD = 16
+)(
+    input clk,
+    input reset_p,
+    input enable,
+    input [7:0] rx_data,
+    input rx_valid,
+    input rx_ferr,
+    input [31:0] gap,                // 바이트 간격 한도 (0 = 끔)
+    output reg [PAYLOAD*8-1:0] payload,  // 바이트 0 = [7:0], 다음 프레임 첫 바이트까지 유지
+    output reg good,                 // CRC 맞음 (1클럭 펄스)
+    output reg crc_err,
+    output reg frame_err,            // 프레임 중 정지 비트 오류 / 간격 초과
+    output busy
+);
+
+    localparam SYNC0 = 8'hA5;
+    localparam SYNC1 = 8'h5A;
+
+    localparam S_HUNT0 = 2'd0;
+    localparam S_HUNT1 = 2'd1;
+    localparam S_BODY  = 2'd2;
+
+    reg [1:0] state;
+    reg [4:0] cnt;                   // 동기 뒤 받은 바이트 수
+    reg [15:0] crc;
+    reg [31:0] idle;
+
+    assign busy = (state != S_HUNT0);
+
+    function [15:0] crc16_byte(input [15:0] c, input [7:0] d);
+        integer k;
+        reg [15:0] x;
+        begin
+            x = c ^ {d, 8'h00};
+            for (k = 0; k < 8; k = k + 1)
+                x = x[15] ? {x[14:0], 1'b0} ^ 16'h1021 : {x[14:0], 1'b0};
+            crc16_byte = x;
+        end
+    endfunction
+
+    wire timeout = (gap != 0) && (idle >= gap);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            state <= S_HUNT0;
+            cnt <= 0;
+            crc <= 16'hFFFF;
+            idle <= 0;
+            payload <= 0;
+            good <= 0;
+            crc_err <= 0;
+            frame_err <= 0;
+        end
+        else begin
+            good <= 0;
+            crc_err <= 0;
+            frame_err <= 0;
+
+            if (rx_valid || state == S_HUNT0) idle <= 0;
+            else if (!timeout) idle <= idle + 1;
+
+            if (!enable) state <= S_HUNT0;
+            else if (state != S_HUNT0 && (rx_ferr || timeout)) begin
+                // 끊긴 프레임은 버리고 동기부터 다시
+                frame_err <= 1;
+                state <= S_HUNT0;
+            end
+            else if (rx_valid) begin
+                case (state)
+                    S_HUNT0: if (rx_data == SYNC0) state <= S_HUNT1;
+
+                    S_HUNT1: begin
+                        if (rx_data == SYNC1) begin
+                            state <= S_BODY;
+                            cnt <= 0;
+                            crc <= 16'hFFFF;
+                        end
+                        else if (rx_data != SYNC0) state <= S_HUNT0;
+                    end
+
+                    S_BODY: begin
+                        crc <= crc16_byte(crc, rx_data);
+                        if (cnt < PAYLOAD) payload[cnt*8 +: 8] <= rx_data;
+                        cnt <= cnt + 1;
+                        if (cnt == PAYLOAD + 1) begin
+                            // 마지막 CRC 바이트까지 넣고 나머지 0이면 통과
+                            good <= (crc16_byte(crc, rx_data) == 0);
+                            crc_err <= (crc16_byte(crc, rx_data) != 0);
+                            state <= S_HUNT0;
+                        end
+                    end
+
+                    default: state <= S_HUNT0;
+                endcase
+            end
+        end
+    end
+
+endmodule
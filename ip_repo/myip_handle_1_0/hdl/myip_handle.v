@@ -16,6 +16,7 @@
 	(
 		// Users to add ports here
         output wire [3:0] motor_control,
+        input wire estop,
 		// User ports ends
 		// Do not modify the ports beyond this line
 
@@ -49,6 +50,7 @@
 		.C_S_AXI_ADDR_WIDTH(C_S00_AXI_ADDR_WIDTH)
 	) myip_handle_slave_lite_v1_0_S00_AXI_inst (
 	    .motor_control(motor_control),
+	    .estop(estop),
 		.S_AXI_ACLK(s00_axi_aclk),
 		.S_AXI_ARESETN(s00_axi_aresetn),
 		.S_AXI_AWADDR(s00_axi_awaddr),
@@ -0,0 +1,19 @@
+/* myip_hbridge 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_HBRIDGE_REGS_H
+#define MYIP_HBRIDGE_REGS_H
+
+#define MYIP_HBRIDGE_CTRL_OFFSET             0x00    /* [0] 출력 허용, [1] 정지 시 브레이크, [2] 센터 정렬 */
+#define MYIP_HBRIDGE_PERIOD_OFFSET           0x04    /* PWM 주기 클럭 수 */
+#define MYIP_HBRIDGE_DEADTIME_OFFSET         0x08    /* 방향 전환 시 출력 끄는 클럭 수 */
+#define MYIP_HBRIDGE_ACCEL_OFFSET            0x0C    /* 주기당 최대 가속 (감속/정지는 바로, 0=제한 없음) */
+#define MYIP_HBRIDGE_SPEED_L_OFFSET          0x10    /* 부호 있는 속도 (+전진, 크기=high 클럭 수) */
+#define MYIP_HBRIDGE_SPEED_R_OFFSET          0x14
+#define MYIP_HBRIDGE_APPLIED_L_OFFSET        0x18    /* 가속 제한을 거친 현재 속도 */
+#define MYIP_HBRIDGE_APPLIED_R_OFFSET        0x1C
+#define MYIP_HBRIDGE_PHASE_L_OFFSET          0x20    /* 펄스 시작 위치 (클럭) */
+#define MYIP_HBRIDGE_PHASE_R_OFFSET          0x24
+#define MYIP_HBRIDGE_CTRL_ENABLE             (1u << 0)
+#define MYIP_HBRIDGE_CTRL_BRAKE              (1u << 1)
+#define MYIP_HBRIDGE_CTRL_CENTER             (1u << 2)
+
+#endif
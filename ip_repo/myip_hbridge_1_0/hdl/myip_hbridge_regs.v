@@ -0,0 +1,98 @@
+`timescale 1 ns / 1 ps
+// myip_hbridge 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 출력 허용, [1] 정지 시 브레이크, [2] 센터 정렬
+// 0x04 PERIOD     rw  PWM 주기 클럭 수
+// 0x08 DEADTIME   rw  방향 전환 시 출력 끄는 클럭 수
+// 0x0C ACCEL      rw  주기당 최대 가속 (감속/정지는 바로, 0=제한 없음)
+// 0x10 SPEED_L    rw  부호 있는 속도 (+전진, 크기=high 클럭 수)
+// 0x14 SPEED_R    rw
+// 0x18 APPLIED_L  ro  가속 제한을 거친 현재 속도
+// 0x1C APPLIED_R  ro
+// 0x20 PHASE_L    rw  펄스 시작 위치 (클럭)
+// 0x24 PHASE_R    rw
+
+module myip_hbridge_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [3 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [3 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] period,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] deadtime,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] accel,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] speed_l,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] speed_r,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] applied_l,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] applied_r,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] phase_l,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] phase_r,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [3:0] IDX_CTRL = 0;
+	localparam [3:0] IDX_PERIOD = 1;
+	localparam [3:0] IDX_DEADTIME = 2;
+	localparam [3:0] IDX_ACCEL = 3;
+	localparam [3:0] IDX_SPEED_L = 4;
+	localparam [3:0] IDX_SPEED_R = 5;
+	localparam [3:0] IDX_APPLIED_L = 6;
+	localparam [3:0] IDX_APPLIED_R = 7;
+	localparam [3:0] IDX_PHASE_L = 8;
+	localparam [3:0] IDX_PHASE_R = 9;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	      period <= 0;
+	      deadtime <= 0;
+	      accel <= 0;
+	      speed_l <= 0;
+	      speed_r <= 0;
+	      phase_l <= 0;
+	      phase_r <= 0;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PERIOD: period[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_DEADTIME: deadtime[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_ACCEL: accel[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_SPEED_L: speed_l[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_SPEED_R: speed_r[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PHASE_L: phase_l[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PHASE_R: phase_r[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_PERIOD: rd_data = period;
+	    IDX_DEADTIME: rd_data = deadtime;
+	    IDX_ACCEL: rd_data = accel;
+	    IDX_SPEED_L: rd_data = speed_l;
+	    IDX_SPEED_R: rd_data = speed_r;
+	    IDX_APPLIED_L: rd_data = applied_l;
+	    IDX_APPLIED_R: rd_data = applied_r;
+	    IDX_PHASE_L: rd_data = phase_l;
+	    IDX_PHASE_R: rd_data = phase_r;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
@@ -0,0 +1,188 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_hbridge_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 6
+	)
+	(
+		// Users to add ports here
+        output wire [3:0] motor_control,   // L298N IN1~IN4
+        output wire [1:0] motor_en,        // L298N ENA/ENB (PWM) [0] 왼쪽, [1] 오른쪽
+        input wire estop,                  // myip_estop: 1이면 출력 모두 끔 (관성 정지)
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 3;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	wire [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// 레지스터 파일 (regmap.json → common/regmap.py 로 생성)
+	wire [C_S_AXI_DATA_WIDTH-1:0] ctrl, period, deadtime, accel, speed_l, speed_r, phase_l, phase_r;
+	wire signed [20:0] applied_l, applied_r;
+
+	myip_hbridge_regs # (
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH)
+	) regs (
+		.clk(S_AXI_ACLK),
+		.resetn(S_AXI_ARESETN),
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(S_AXI_WDATA),
+		.wr_strb(S_AXI_WSTRB),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.ctrl(ctrl),
+		.period(period),
+		.deadtime(deadtime),
+		.accel(accel),
+		.speed_l(speed_l),
+		.speed_r(speed_r),
+		.applied_l({{11{applied_l[20]}}, applied_l}),
+		.applied_r({{11{applied_r[20]}}, applied_r}),
+		.phase_l(phase_l),
+		.phase_r(phase_r),
+		.rd_data(rd_data)
+	);
+
+	// Add user logic here
+    wire [19:0] pwm_cnt;
+    wire period_end;
+    wire [3:0] mc_raw;
+    wire [1:0] en_raw;
+
+    hbridge_timebase timebase(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]),
+        .period(period[19:0]), .cnt(pwm_cnt), .period_end(period_end));
+
+    // motor_control 비트 순서는 myip_handle과 같음: [0] 왼쪽 전진, [1] 왼쪽 후진, [2] 오른쪽 후진, [3] 오른쪽 전진
+    hbridge_channel left_ch(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]), .brake_mode(ctrl[1]),
+        .period(period[19:0]), .cnt(pwm_cnt), .period_end(period_end), .dead_time(deadtime[15:0]), .accel(accel[19:0]),
+        .phase(phase_l[19:0]), .center(ctrl[2]), .speed_cmd(speed_l[20:0]), .speed_applied(applied_l),
+        .in1(mc_raw[0]), .in2(mc_raw[1]), .en(en_raw[0]));
+
+    hbridge_channel right_ch(.clk(S_AXI_ACLK), .reset_p(~S_AXI_ARESETN), .enable(ctrl[0]), .brake_mode(ctrl[1]),
+        .period(period[19:0]), .cnt(pwm_cnt), .period_end(period_end), .dead_time(deadtime[15:0]), .accel(accel[19:0]),
+        .phase(phase_r[19:0]), .center(ctrl[2]), .speed_cmd(speed_r[20:0]), .speed_applied(applied_r),
+        .in1(mc_raw[3]), .in2(mc_raw[2]), .en(en_raw[1]));
+
+    // 비상정지는 채널 상태와 상관없이 핀에서 바로 끔 (해제 전에 펌웨어가 속도를 0으로)
+    assign motor_control = estop ? 4'b0000 : mc_raw;
+    assign motor_en = estop ? 2'b00 : en_raw;
+	// User logic ends
+
+	endmodule
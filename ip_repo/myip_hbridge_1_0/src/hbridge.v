@@ -0,0 +1,131 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// L298N 한 채널 (IN1/IN2/EN)
+// 부호 있는 속도 한 번 쓰기로 방향 + duty가 같은 클럭에 바뀜
+// 방향이 바뀔 때는 dead-time 동안 출력을 모두 끈 뒤 반대 방향으로 시작
+// 펄스 위치는 채널별 phase(+센터 정렬)로 옮길 수 있음: 두 바퀴가 같은 엣지에서 켜지지 않게
+//////////////////////////////////////////////////////////////////////////////////
+
+// PWM 주기 카운터 (채널들이 공유)
+module hbridge_timebase(
+    input clk,
+    input reset_p,
+    input enable,
+    input [19:0] period,         // 주기 클럭 수
+    output reg [19:0] cnt,
+    output period_end            // 마지막 클럭 (1클럭 펄스)
+);
+
+    assign period_end = enable && (cnt >= period - 1);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) cnt <= 0;
+        else if (!enable || period == 0) cnt <= 0;
+        else if (period_end) cnt <= 0;
+        else cnt <= cnt + 1;
+    end
+
+endmodule
+
+module hbridge_channel(
+    input clk,
+    input reset_p,
+    input enable,
+    input brake_mode,            // 속도 0일 때 1: 브레이크 (IN1=IN2=1, EN=1), 0: 코스트 (모두 0)
+    input [19:0] period,
+    input [19:0] cnt,
+    input period_end,
+    input [15:0] dead_time,      // 방향 전환 시 출력 끄는 클럭 수
+    input [19:0] accel,          // 주기당 최대 가속 (0에서 멀어지는 쪽만, 0이면 제한 없음)
+    input [19:0] phase,          // 펄스 시작 위치 (클럭, period보다 작게)
+    input center,                // 1: 펄스 가운데를 phase + period/2에 맞춤
+    input signed [20:0] speed_cmd,   // +: 전진, -: 후진, 크기 = high 클럭 수
+    output reg signed [20:0] speed_applied,
+    output reg in1,
+    output reg in2,
+    output reg en
+);
+
+    // 명령을 주기 범위로 제한
+    wire signed [20:0] period_s = {1'b0, period};
+    wire signed [20:0] cmd_clamped = (speed_cmd > period_s) ? period_s :
+                                     (speed_cmd < -period_s) ? -period_s : speed_cmd;
+
+    // 가속 제한: 0에서 멀어질 때만 주기 끝마다 최대 accel 만큼 이동
+    // 감속/정지(0)는 바로 반영, 반대 방향 명령은 0에서 다시 가속 (정지가 램프에 묶이지 않게)
+    wire signed [20:0] accel_s = {1'b0, accel};
+    wire cross = (speed_applied > 0 && cmd_clamped <= 0) || (speed_applied < 0 && cmd_clamped >= 0);
+    wire signed [20:0] base = cross ? 21'sd0 : speed_applied;
+    wire away = (cmd_clamped > base && base >= 0) || (cmd_clamped < base && base <= 0);
+    wire signed [21:0] diff = cmd_clamped - base;
+    wire signed [20:0] ramped = (accel == 0 || !away) ? cmd_clamped :
+                                (diff > accel_s) ? base + accel_s :
+                                (diff < -accel_s) ? base - accel_s : cmd_clamped;
+
+    // 펄스 구간 시작점: duty와 같이 주기 경계에서만 바뀜
+    wire [19:0] ramped_mag = (ramped < 0) ? -ramped : ramped;
+    wire [20:0] start_sum = phase + ((center && ramped_mag < period) ? (period - ramped_mag) >> 1 : 20'd0);
+    wire [19:0] start_next = (start_sum >= period) ? start_sum - period : start_sum;
+    reg [19:0] start;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            speed_applied <= 0;
+            start <= 0;
+        end
+        else if (!enable) begin
+            speed_applied <= 0;
+            start <= 0;
+        end
+        else if (period_end) begin
+            speed_applied <= ramped;
+            start <= start_next;
+        end
+    end
+
+    // 시작점 기준으로 돌린 카운터
+    wire [19:0] cnt_shift = (cnt >= start) ? cnt - start : cnt + period - start;
+
+    // 방향 상태 + dead-time
+    reg dir_rev;                 // 현재 H-bridge 방향 (1: 후진)
+    reg [15:0] dead_cnt;
+    wire want_rev = speed_applied < 0;
+    wire [19:0] mag = want_rev ? -speed_applied : speed_applied;
+    wire dead = (dead_cnt != 0);
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            dir_rev <= 0;
+            dead_cnt <= 0;
+        end
+        else if (dead) dead_cnt <= dead_cnt - 1;
+        else if (speed_applied != 0 && want_rev != dir_rev) begin
+            dir_rev <= want_rev;
+            dead_cnt <= dead_time;
+        end
+    end
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            in1 <= 0;
+            in2 <= 0;
+            en <= 0;
+        end
+        else if (!enable || dead || (speed_applied != 0 && want_rev != dir_rev)) begin
+            in1 <= 0;
+            in2 <= 0;
+            en <= 0;
+        end
+        else if (speed_applied == 0) begin
+            in1 <= brake_mode;
+            in2 <= brake_mode;
+            en <= brake_mode;
+        end
+        else begin
+            in1 <= ~dir_rev;
+            in2 <= dir_rev;
+            en <= (cnt_shift < mag);
+        end
+    end
+
+endmodule
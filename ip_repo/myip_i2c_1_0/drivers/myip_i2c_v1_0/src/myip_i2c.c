@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_i2c.h"
+
+/************************** Function Definitions ***************************/
@@ -0,0 +1,27 @@
+/* myip_i2c 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_I2C_REGS_H
+#define MYIP_I2C_REGS_H
+
+#define MYIP_I2C_CTRL_OFFSET                 0x00    /* [0] 동작, [1] STOP 완료 인터럽트, [2] NACK 인터럽트 */
+#define MYIP_I2C_PRESCALE_OFFSET             0x04    /* SCL 1/4 주기 클럭 수 (100MHz: 250=100kHz, 63=400kHz, 25=1MHz) */
+#define MYIP_I2C_TX_OFFSET                   0x08    /* 명령 FIFO에 넣기: [7:0] 바이트, [8] 앞에 START (버스 사용 중이면 반복 START), [9] 뒤에 STOP, [10] 읽기, [11] 읽고 NACK */
+#define MYIP_I2C_RX_OFFSET                   0x0C    /* [7:0] 받은 바이트, [8] 유효 (읽으면 FIFO에서 꺼냄) */
+#define MYIP_I2C_STATUS_OFFSET               0x10    /* [0] 동작 중, [1] TX 가득, [2] TX 빔, [3] RX 빔, [15:8] TX 개수, [23:16] RX 개수 */
+#define MYIP_I2C_IRQ_OFFSET                  0x14    /* [0] STOP 완료, [1] NACK 받음 (읽으면 지움) */
+#define MYIP_I2C_FLUSH_OFFSET                0x18    /* [0] TX FIFO 비움, [1] RX FIFO 비움 */
+#define MYIP_I2C_CTRL_ENABLE                 (1u << 0)
+#define MYIP_I2C_CTRL_IRQ_DONE               (1u << 1)
+#define MYIP_I2C_CTRL_IRQ_NACK               (1u << 2)
+#define MYIP_I2C_TX_START                    (1u << 8)
+#define MYIP_I2C_TX_STOP                     (1u << 9)
+#define MYIP_I2C_TX_READ                     (1u << 10)
+#define MYIP_I2C_TX_NACK                     (1u << 11)
+#define MYIP_I2C_RX_VALID                    (1u << 8)
+#define MYIP_I2C_STATUS_BUSY                 (1u << 0)
+#define MYIP_I2C_STATUS_TX_FULL              (1u << 1)
+#define MYIP_I2C_STATUS_TX_EMPTY             (1u << 2)
+#define MYIP_I2C_STATUS_RX_EMPTY             (1u << 3)
+#define MYIP_I2C_IRQ_DONE                    (1u << 0)
+#define MYIP_I2C_IRQ_NACK                    (1u << 1)
+
+#endif
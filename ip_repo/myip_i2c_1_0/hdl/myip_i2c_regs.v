@@ -0,0 +1,79 @@
+`timescale 1 ns / 1 ps
+// myip_i2c 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 동작, [1] STOP 완료 인터럽트, [2] NACK 인터럽트
+// 0x04 PRESCALE   rw  SCL 1/4 주기 클럭 수 (100MHz: 250=100kHz, 63=400kHz, 25=1MHz)
+// 0x08 TX         wp  명령 FIFO에 넣기: [7:0] 바이트, [8] 앞에 START (버스 사용 중이면 반복 START), [9] 뒤에 STOP, [10] 읽기, [11] 읽고 NACK
+// 0x0C RX         rc  [7:0] 받은 바이트, [8] 유효 (읽으면 FIFO에서 꺼냄)
+// 0x10 STATUS     ro  [0] 동작 중, [1] TX 가득, [2] TX 빔, [3] RX 빔, [15:8] TX 개수, [23:16] RX 개수
+// 0x14 IRQ        rc  [0] STOP 완료, [1] NACK 받음 (읽으면 지움)
+// 0x18 FLUSH      wp  [0] TX FIFO 비움, [1] RX FIFO 비움
+
+module myip_i2c_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [3 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [3 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] prescale,
+	output wire  tx_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] rx,
+	output wire  rx_rd,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] status,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] irq,
+	output wire  irq_rd,
+	output wire  flush_wr,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [3:0] IDX_CTRL = 0;
+	localparam [3:0] IDX_PRESCALE = 1;
+	localparam [3:0] IDX_TX = 2;
+	localparam [3:0] IDX_RX = 3;
+	localparam [3:0] IDX_STATUS = 4;
+	localparam [3:0] IDX_IRQ = 5;
+	localparam [3:0] IDX_FLUSH = 6;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	      prescale <= 250;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          IDX_PRESCALE: prescale[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign tx_wr = wr_en && (wr_idx == IDX_TX);
+	assign rx_rd = rd_en && (rd_idx == IDX_RX);
+	assign irq_rd = rd_en && (rd_idx == IDX_IRQ);
+	assign flush_wr = wr_en && (wr_idx == IDX_FLUSH);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_PRESCALE: rd_data = prescale;
+	    IDX_RX: rd_data = rx;
+	    IDX_STATUS: rd_data = status;
+	    IDX_IRQ: rd_data = irq;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
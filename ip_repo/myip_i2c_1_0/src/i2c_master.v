@@ -0,0 +1,259 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// FIFO 기반 I2C 마스터
+// 명령 FIFO 한 칸 = 바이트 하나 + START/STOP/읽기/NACK 플래그
+//   쓰기 버스트: {START, 주소+W} {데이터} ... {STOP, 마지막 데이터}
+//   레지스터 읽기: {START, 주소+W} {레지스터} {START, 주소+R} {읽기} ... {읽기, NACK, STOP}
+// SCL/SDA는 오픈 드레인 (oe=1이면 0으로 당김), 슬레이브의 클럭 스트레칭 지원
+// FIFO가 비었는데 STOP이 없으면 SCL을 낮게 잡고 다음 명령을 기다림
+//////////////////////////////////////////////////////////////////////////////////
+
+// 동기 FIFO (레지스터 배열)
+module i2c_fifo #(
+    parameter WIDTH = 8,
+    parameter AW = 4                 // 깊이 = 2^AW
+)(
+    input clk,
+    input reset_p,
+    input flush,
+    input push,
+    input [WIDTH-1:0] din,
+    input pop,
+    output [WIDTH-1:0] dout,         // 맨 앞 값 (pop 전에 읽음)
+    output empty,
+    output full,
+    output reg [AW:0] level
+);
+
+    reg [WIDTH-1:0] mem [0:(1 << AW) - 1];
+    reg [AW-1:0] wp, rp;
+
+    wire do_push = push && !full;
+    wire do_pop = pop && !empty;
+
+    assign dout = mem[rp];
+    assign empty = (level == 0);
+    assign full = (level == (1 << AW));
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            wp <= 0;
+            rp <= 0;
+            level <= 0;
+        end
+        else if (flush) begin
+            wp <= 0;
+            rp <= 0;
+            level <= 0;
+        end
+        else begin
+            if (do_push) wp <= wp + 1;
+            if (do_pop) rp <= rp + 1;
+            level <= level + do_push - do_pop;
+        end
+    end
+
+    always @(posedge clk) begin
+        if (do_push) mem[wp] <= din;
+    end
+
+endmodule
+
+module i2c_master_core #(
+    parameter FIFO_AW = 4
+)(
+    input clk,
+    input reset_p,
+    input enable,
+    input [15:0] prescale,           // SCL 1/4 주기 클럭 수
+    input tx_push,
+    input [11:0] tx_cmd,             // [7:0] 바이트, [8] START, [9] STOP, [10] 읽기, [11] NACK
+    input rx_pop,
+    input flush_tx,
+    input flush_rx,
+    output [7:0] rx_data,
+    output rx_empty,
+    output tx_empty,
+    output tx_full,
+    output [FIFO_AW:0] tx_level,
+    output [FIFO_AW:0] rx_level,
+    output busy,
+    output reg done,                 // STOP 완료 (1클럭 펄스)
+    output reg nack,                 // 쓰기 중 NACK (1클럭 펄스, 이 트랜잭션의 남은 명령은 STOP 칸까지 버림)
+    input scl_i,
+    input sda_i,
+    output reg scl_oe,
+    output reg sda_oe
+);
+
+    localparam S_IDLE  = 2'd0;
+    localparam S_START = 2'd1;
+    localparam S_BYTE  = 2'd2;
+    localparam S_STOP  = 2'd3;
+
+    reg [1:0] state;
+    reg [1:0] q;                     // 비트 안의 1/4 주기 단계
+    reg [15:0] q_cnt;
+    reg [3:0] bit_idx;               // 7..0 데이터, 8 = ACK
+    reg [11:0] cur;
+    reg [7:0] shift;
+    reg bus_active;                  // START 후 STOP 전
+    reg got_nack;
+    reg skip;                        // NACK 난 트랜잭션의 남은 명령을 STOP 칸까지 버리는 중
+
+    wire [11:0] tx_head;
+    wire rx_full;
+    reg tx_pop, rx_push;
+
+    i2c_fifo #(.WIDTH(12), .AW(FIFO_AW)) tx_fifo(.clk(clk), .reset_p(reset_p), .flush(flush_tx),
+        .push(tx_push), .din(tx_cmd), .pop(tx_pop), .dout(tx_head), .empty(tx_empty), .full(tx_full), .level(tx_level));
+
+    i2c_fifo #(.WIDTH(8), .AW(FIFO_AW)) rx_fifo(.clk(clk), .reset_p(reset_p), .flush(flush_rx),
+        .push(rx_push), .din(shift), .pop(rx_pop), .dout(rx_data), .empty(rx_empty), .full(rx_full), .level(rx_level));
+
+    assign busy = (state != S_IDLE) || bus_active || skip;
+
+    // 2단 동기화 (SCL 스트레칭 확인, SDA 샘플)
+    reg [1:0] scl_s, sda_s;
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            scl_s <= 2'b11;
+            sda_s <= 2'b11;
+        end
+        else begin
+            scl_s <= {scl_s[0], scl_i};
+            sda_s <= {sda_s[0], sda_i};
+        end
+    end
+
+    // 1/4 주기 틱 (SCL을 놓은 단계에서는 실제로 high가 될 때까지 멈춤)
+    wire stretch = (q == 2'd2) && !scl_oe && !scl_s[1];
+    wire q_tick = (q_cnt + 1 >= prescale) && !stretch;
+
+    wire is_read = cur[10];
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            state <= S_IDLE;
+            q <= 0;
+            q_cnt <= 0;
+            bit_idx <= 0;
+            cur <= 0;
+            shift <= 0;
+            bus_active <= 0;
+            scl_oe <= 0;
+            sda_oe <= 0;
+            tx_pop <= 0;
+            rx_push <= 0;
+            done <= 0;
+            nack <= 0;
+            got_nack <= 0;
+            skip <= 0;
+        end
+        else begin
+            tx_pop <= 0;
+            rx_push <= 0;
+            done <= 0;
+            nack <= 0;
+            if (flush_tx) skip <= 0;
+
+            if (state == S_IDLE) q_cnt <= 0;
+            else if (q_tick) q_cnt <= 0;
+            else if (!stretch) q_cnt <= q_cnt + 1;
+
+            case (state)
+                S_IDLE: begin
+                    q <= 0;
+                    if (!bus_active) begin
+                        scl_oe <= 0;
+                        sda_oe <= 0;
+                    end
+                    // NACK 뒤: 뒤따르는 트랜잭션은 남기고 실패한 것만 STOP 칸까지 버림 (아직 안 들어온 칸은 기다림)
+                    if (skip) begin
+                        if (!tx_empty && !tx_pop && !flush_tx) begin
+                            tx_pop <= 1;
+                            if (tx_head[9]) skip <= 0;
+                        end
+                    end
+                    // 읽기 명령은 RX FIFO에 자리가 있을 때만 시작
+                    else if (enable && !tx_empty && !tx_pop && !(tx_head[10] && rx_full)) begin
+                        cur <= tx_head;
+                        tx_pop <= 1;
+                        if (tx_head[8] || !bus_active) state <= S_START;
+                        else begin
+                            state <= S_BYTE;
+                            bit_idx <= 7;
+                            shift <= tx_head[10] ? 8'hFF : tx_head[7:0];
+                        end
+                    end
+                end
+
+                // 버스가 쉬는 중이면 SCL/SDA 모두 high라서 앞 두 단계는 그대로 지나감
+                S_START: if (q_tick) begin
+                    q <= q + 1;
+                    case (q)
+                        2'd0: sda_oe <= 0;             // SDA 놓음 (SCL low 동안)
+                        2'd1: scl_oe <= 0;             // SCL 놓음 → high 확인 후 다음 단계
+                        2'd2: sda_oe <= 1;             // SCL high에서 SDA 내림 = START
+                        2'd3: begin
+                            scl_oe <= 1;
+                            bus_active <= 1;
+                            state <= S_BYTE;
+                            bit_idx <= 7;
+                            shift <= is_read ? 8'hFF : cur[7:0];
+                        end
+                    endcase
+                end
+
+                S_BYTE: if (q_tick) begin
+                    q <= q + 1;
+                    case (q)
+                        2'd0: begin
+                            // SCL low 동안 SDA 준비
+                            if (bit_idx == 8) sda_oe <= is_read && !cur[11];   // 읽기: ACK(0) / 마지막이면 NACK(1)
+                            else sda_oe <= is_read ? 1'b0 : !shift[7];
+                        end
+                        2'd1: scl_oe <= 0;
+                        2'd2: begin
+                            if (bit_idx != 8) shift <= {shift[6:0], sda_s[1]};
+                            else begin
+                                got_nack <= !is_read && sda_s[1];
+                                nack <= !is_read && sda_s[1];
+                            end
+                        end
+                        2'd3: begin
+                            scl_oe <= 1;
+                            if (bit_idx == 0) bit_idx <= 8;
+                            else if (bit_idx == 8) begin
+                                if (is_read) rx_push <= 1;
+                                if (got_nack) begin
+                                    // NACK: STOP 을 내고, 이 칸이 끝이 아니면 남은 칸은 S_IDLE 에서 버림
+                                    skip <= !cur[9];
+                                    state <= S_STOP;
+                                end
+                                else if (cur[9]) state <= S_STOP;
+                                else state <= S_IDLE;
+                            end
+                            else bit_idx <= bit_idx - 1;
+                        end
+                    endcase
+                end
+
+                S_STOP: if (q_tick) begin
+                    q <= q + 1;
+                    case (q)
+                        2'd0: sda_oe <= 1;             // SCL low 동안 SDA 내림
+                        2'd1: scl_oe <= 0;
+                        2'd2: sda_oe <= 0;             // SCL high에서 SDA 올림 = STOP
+                        2'd3: begin
+                            bus_active <= 0;
+                            done <= 1;
+                            state <= S_IDLE;
+                        end
+                    endcase
+                end
+            endcase
+        end
+    end
+
+endmodule
@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_mailbox.h"
+
+/************************** Function Definitions ***************************/
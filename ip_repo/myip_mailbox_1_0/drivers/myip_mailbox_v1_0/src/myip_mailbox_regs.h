@@ -0,0 +1,13 @@
+/* myip_mailbox 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_MAILBOX_REGS_H
+#define MYIP_MAILBOX_REGS_H
+
+#define MYIP_MAILBOX_DOORBELL_OFFSET         0x100    /* 쓰면 상대 포트의 IRQ [0]을 세움 (데이터 무시) */
+#define MYIP_MAILBOX_IRQ_OFFSET              0x104    /* [0] 상대 포트가 초인종을 울림 (읽으면 지움) */
+#define MYIP_MAILBOX_CTRL_OFFSET             0x108    /* [0] 초인종 인터럽트 허용 */
+#define MYIP_MAILBOX_INFO_OFFSET             0x10C    /* [0] 포트 번호 (0=S00, 1=S01), [15:8] 블록 워드 수 */
+#define MYIP_MAILBOX_IRQ_BELL                (1u << 0)
+#define MYIP_MAILBOX_CTRL_IRQ_EN             (1u << 0)
+#define MYIP_MAILBOX_INFO_PORT               (1u << 0)
+
+#endif
@@ -0,0 +1,167 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_mailbox #
+	(
+		// Users to add parameters here
+
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+
+		// Parameters of Axi Slave Bus Interface S00_AXI
+		parameter integer C_S00_AXI_DATA_WIDTH	= 32,
+		parameter integer C_S00_AXI_ADDR_WIDTH	= 9,
+
+		// Parameters of Axi Slave Bus Interface S01_AXI
+		parameter integer C_S01_AXI_DATA_WIDTH	= 32,
+		parameter integer C_S01_AXI_ADDR_WIDTH	= 9
+	)
+	(
+		// Users to add ports here
+        output wire mbox0_intr,     // S00 쪽 코어로: S01 이 초인종을 울림
+        output wire mbox1_intr,     // S01 쪽 코어로: S00 이 초인종을 울림
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+
+		// Ports of Axi Slave Bus Interface S00_AXI
+		input wire  s00_axi_aclk,
+		input wire  s00_axi_aresetn,
+		input wire [C_S00_AXI_ADDR_WIDTH-1 : 0] s00_axi_awaddr,
+		input wire [2 : 0] s00_axi_awprot,
+		input wire  s00_axi_awvalid,
+		output wire  s00_axi_awready,
+		input wire [C_S00_AXI_DATA_WIDTH-1 : 0] s00_axi_wdata,
+		input wire [(C_S00_AXI_DATA_WIDTH/8)-1 : 0] s00_axi_wstrb,
+		input wire  s00_axi_wvalid,
+		output wire  s00_axi_wready,
+		output wire [1 : 0] s00_axi_bresp,
+		output wire  s00_axi_bvalid,
+		input wire  s00_axi_bready,
+		input wire [C_S00_AXI_ADDR_WIDTH-1 : 0] s00_axi_araddr,
+		input wire [2 : 0] s00_axi_arprot,
+		input wire  s00_axi_arvalid,
+		output wire  s00_axi_arready,
+		output wire [C_S00_AXI_DATA_WIDTH-1 : 0] s00_axi_rdata,
+		output wire [1 : 0] s00_axi_rresp,
+		output wire  s00_axi_rvalid,
+		input wire  s00_axi_rready,
+
+		// Ports of Axi Slave Bus Interface S01_AXI
+		// 두 코어는 같은 클럭: S01 도 s00_axi_aclk / s00_axi_aresetn 을 씀
+		input wire [C_S01_AXI_ADDR_WIDTH-1 : 0] s01_axi_awaddr,
+		input wire [2 : 0] s01_axi_awprot,
+		input wire  s01_axi_awvalid,
+		output wire  s01_axi_awready,
+		input wire [C_S01_AXI_DATA_WIDTH-1 : 0] s01_axi_wdata,
+		input wire [(C_S01_AXI_DATA_WIDTH/8)-1 : 0] s01_axi_wstrb,
+		input wire  s01_axi_wvalid,
+		output wire  s01_axi_wready,
+		output wire [1 : 0] s01_axi_bresp,
+		output wire  s01_axi_bvalid,
+		input wire  s01_axi_bready,
+		input wire [C_S01_AXI_ADDR_WIDTH-1 : 0] s01_axi_araddr,
+		input wire [2 : 0] s01_axi_arprot,
+		input wire  s01_axi_arvalid,
+		output wire  s01_axi_arready,
+		output wire [C_S01_AXI_DATA_WIDTH-1 : 0] s01_axi_rdata,
+		output wire [1 : 0] s01_axi_rresp,
+		output wire  s01_axi_rvalid,
+		input wire  s01_axi_rready
+	);
+
+	// 블록 0: S00 만 씀, 블록 1: S01 만 씀 (둘 다 두 블록을 읽음)
+	wire blk0_we, blk1_we;
+	wire [3:0] blk0_wstrb, blk1_wstrb;
+	wire [4:0] blk0_waddr, blk1_waddr, s00_raddr, s01_raddr;
+	wire [31:0] blk0_wdata, blk1_wdata;
+	wire [31:0] blk0_s00_rdata, blk0_s01_rdata, blk1_s00_rdata, blk1_s01_rdata;
+	wire bell0, bell1;
+
+	mailbox_block blk0(.clk(s00_axi_aclk), .we(blk0_we), .wstrb(blk0_wstrb), .waddr(blk0_waddr), .wdata(blk0_wdata),
+		.raddr_a(s00_raddr), .rdata_a(blk0_s00_rdata), .raddr_b(s01_raddr), .rdata_b(blk0_s01_rdata));
+	mailbox_block blk1(.clk(s00_axi_aclk), .we(blk1_we), .wstrb(blk1_wstrb), .waddr(blk1_waddr), .wdata(blk1_wdata),
+		.raddr_a(s00_raddr), .rdata_a(blk1_s00_rdata), .raddr_b(s01_raddr), .rdata_b(blk1_s01_rdata));
+// Instantiation of Axi Bus Interface S00_AXI
+	myip_mailbox_slave_lite_v1_0_S00_AXI # ( 
+		.C_PORT(0),
+		.C_S_AXI_DATA_WIDTH(C_S00_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S00_AXI_ADDR_WIDTH)
+	) myip_mailbox_slave_lite_v1_0_S00_AXI_inst (
+	    .mbox_intr(mbox0_intr),
+	    .bell_out(bell0),
+	    .bell_in(bell1),
+	    .blk_we(blk0_we),
+	    .blk_wstrb(blk0_wstrb),
+	    .blk_waddr(blk0_waddr),
+	    .blk_wdata(blk0_wdata),
+	    .blk_raddr(s00_raddr),
+	    .blk0_rdata(blk0_s00_rdata),
+	    .blk1_rdata(blk1_s00_rdata),
+		.S_AXI_ACLK(s00_axi_aclk),
+		.S_AXI_ARESETN(s00_axi_aresetn),
+		.S_AXI_AWADDR(s00_axi_awaddr),
+		.S_AXI_AWPROT(s00_axi_awprot),
+		.S_AXI_AWVALID(s00_axi_awvalid),
+		.S_AXI_AWREADY(s00_axi_awready),
+		.S_AXI_WDATA(s00_axi_wdata),
+		.S_AXI_WSTRB(s00_axi_wstrb),
+		.S_AXI_WVALID(s00_axi_wvalid),
+		.S_AXI_WREADY(s00_axi_wready),
+		.S_AXI_BRESP(s00_axi_bresp),
+		.S_AXI_BVALID(s00_axi_bvalid),
+		.S_AXI_BREADY(s00_axi_bready),
+		.S_AXI_ARADDR(s00_axi_araddr),
+		.S_AXI_ARPROT(s00_axi_arprot),
+		.S_AXI_ARVALID(s00_axi_arvalid),
+		.S_AXI_ARREADY(s00_axi_arready),
+		.S_AXI_RDATA(s00_axi_rdata),
+		.S_AXI_RRESP(s00_axi_rresp),
+		.S_AXI_RVALID(s00_axi_rvalid),
+		.S_AXI_RREADY(s00_axi_rready)
+	);
+
+	myip_mailbox_slave_lite_v1_0_S00_AXI # ( 
+		.C_PORT(1),
+		.C_S_AXI_DATA_WIDTH(C_S01_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S01_AXI_ADDR_WIDTH)
+	) myip_mailbox_slave_lite_v1_0_S01_AXI_inst (
+	    .mbox_intr(mbox1_intr),
+	    .bell_out(bell1),
+	    .bell_in(bell0),
+	    .blk_we(blk1_we),
+	    .blk_wstrb(blk1_wstrb),
+	    .blk_waddr(blk1_waddr),
+	    .blk_wdata(blk1_wdata),
+	    .blk_raddr(s01_raddr),
+	    .blk0_rdata(blk0_s01_rdata),
+	    .blk1_rdata(blk1_s01_rdata),
+		.S_AXI_ACLK(s00_axi_aclk),
+		.S_AXI_ARESETN(s00_axi_aresetn),
+		.S_AXI_AWADDR(s01_axi_awaddr),
+		.S_AXI_AWPROT(s01_axi_awprot),
+		.S_AXI_AWVALID(s01_axi_awvalid),
+		.S_AXI_AWREADY(s01_axi_awready),
+		.S_AXI_WDATA(s01_axi_wdata),
+		.S_AXI_WSTRB(s01_axi_wstrb),
+		.S_AXI_WVALID(s01_axi_wvalid),
+		.S_AXI_WREADY(s01_axi_wready),
+		.S_AXI_BRESP(s01_axi_bresp),
+		.S_AXI_BVALID(s01_axi_bvalid),
+		.S_AXI_BREADY(s01_axi_bready),
+		.S_AXI_ARADDR(s01_axi_araddr),
+		.S_AXI_ARPROT(s01_axi_arprot),
+		.S_AXI_ARVALID(s01_axi_arvalid),
+		.S_AXI_ARREADY(s01_axi_arready),
+		.S_AXI_RDATA(s01_axi_rdata),
+		.S_AXI_RRESP(s01_axi_rresp),
+		.S_AXI_RVALID(s01_axi_rvalid),
+		.S_AXI_RREADY(s01_axi_rready)
+	);
+
+	// Add user logic here
+
+	// User logic ends
+
+	endmodule
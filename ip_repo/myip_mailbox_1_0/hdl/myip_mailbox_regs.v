@@ -0,0 +1,63 @@
+`timescale 1 ns / 1 ps
+// myip_mailbox 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x100 DOORBELL   wp  쓰면 상대 포트의 IRQ [0]을 세움 (데이터 무시)
+// 0x104 IRQ        rc  [0] 상대 포트가 초인종을 울림 (읽으면 지움)
+// 0x108 CTRL       rw  [0] 초인종 인터럽트 허용
+// 0x10C INFO       ro  [0] 포트 번호 (0=S00, 1=S01), [15:8] 블록 워드 수
+
+module myip_mailbox_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [6 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [6 : 0] rd_idx,
+	output wire  doorbell_wr,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] irq,
+	output wire  irq_rd,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] info,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [6:0] IDX_DOORBELL = 64;
+	localparam [6:0] IDX_IRQ = 65;
+	localparam [6:0] IDX_CTRL = 66;
+	localparam [6:0] IDX_INFO = 67;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	assign doorbell_wr = wr_en && (wr_idx == IDX_DOORBELL);
+	assign irq_rd = rd_en && (rd_idx == IDX_IRQ);
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_IRQ: rd_data = irq;
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_INFO: rd_data = info;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
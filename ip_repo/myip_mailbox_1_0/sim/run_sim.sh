@@ -0,0 +1,15 @@
+#!/bin/sh
+# myip_mailbox Verilator 테스트벤치 실행 (일반 리눅스 + verilator 5.x / 4.2xx)
+#   ./run_sim.sh
+# 두 포트를 같은 클럭에서 동시에 구동하므로 공통 AxiLiteMaster 대신 테스트벤치 안의 포트 모델 사용
+set -e
+cd "$(dirname "$0")"
+
+verilator --cc --exe --build -j 0 -O3 -Wno-fatal -Wno-lint -Wno-style \
+    --top-module myip_mailbox -CFLAGS "-O2" \
+    ../hdl/myip_mailbox.v ../hdl/myip_mailbox_slave_lite_v1_0_S00_AXI.v ../hdl/myip_mailbox_regs.v \
+    ../hdl/axil_slave_pipe.v ../src/mailbox.v \
+    tb_myip_mailbox.cpp -o tb_myip_mailbox
+
+./obj_dir/tb_myip_mailbox | tee sim.log
+grep -q '^PASS' sim.log
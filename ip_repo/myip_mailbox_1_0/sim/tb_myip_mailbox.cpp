@@ -0,0 +1,303 @@
+// myip_mailbox Verilator 테스트벤치
+// 두 AXI-Lite 포트를 같은 클럭에서 동시에 움직여 코어 두 개를 흉내 냄
+//  1) 블록 주인 규칙 (상대 블록 쓰기는 무시), 바이트 strobe, INFO
+//  2) 초인종 → 상대 포트 인터럽트 / IRQ 읽으면 지워짐
+//  3) 시퀀스 잠금 스트레스: 포트마다 자기 블록 갱신 + 상대 블록 읽기를 섞어서 반복,
+//     읽은 묶음이 한 세대의 값으로만 이루어졌는지 (찢어진 읽기 없음) 확인
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include "verilated.h"
+#include "Vmyip_mailbox.h"
+
+#define BLK0            0x000   // 포트 0 (통신 코어) 블록
+#define BLK1            0x080   // 포트 1 (모션 코어) 블록
+#define REG_DOORBELL    0x100
+#define REG_IRQ         0x104
+#define REG_CTRL        0x108
+#define REG_INFO        0x10C
+
+#define PAYLOAD_WORDS   8       // 시퀀스 워드 뒤 묶음 크기 (펌웨어 명령 묶음과 비슷)
+#define STRESS_CYCLES   400000
+#define TIMEOUT         1000
+
+static Vmyip_mailbox *top;
+static uint64_t cycles;
+static int fails, checks;
+
+static void check(bool ok, const char *what, uint32_t got, uint32_t want) {
+    checks++;
+    if (!ok) {
+        fails++;
+        printf("FAIL %s: got 0x%08x want 0x%08x\n", what, got, want);
+    }
+}
+
+// 포트 하나의 AXI-Lite 마스터 (한 번에 전송 하나, MicroBlaze-V 비캐시 접근과 같음)
+// 두 포트가 같은 클럭을 쓰므로 tick()은 바깥에서 한 번만 돌리고 포트는 엣지 전후만 처리
+struct AxiPort {
+    SData *awaddr; CData *awvalid; CData *awready; IData *wdata; CData *wstrb; CData *wvalid; CData *wready;
+    CData *bvalid; CData *bready; SData *araddr; CData *arvalid; CData *arready; IData *rdata; CData *rvalid; CData *rready;
+
+    enum { IDLE, WR, RD } state = IDLE;
+    bool aw_done = false, w_done = false, ar_done = false;
+    bool aw_hs = false, w_hs = false, b_hs = false, ar_hs = false, r_hs = false;
+    uint32_t r_data = 0;
+    uint32_t result = 0;        // 마지막 읽기 값
+    bool completed = false;     // 이번 엣지에 전송이 끝남
+    unsigned wait = 0;
+
+    bool busy() const { return state != IDLE; }
+
+    void write(uint32_t a, uint32_t d, uint8_t strb = 0xF) {
+        *awaddr = a; *awvalid = 1; *wdata = d; *wstrb = strb; *wvalid = 1; *bready = 1;
+        aw_done = w_done = false;
+        state = WR;
+        wait = 0;
+    }
+
+    void read(uint32_t a) {
+        *araddr = a; *arvalid = 1; *rready = 1;
+        ar_done = false;
+        state = RD;
+        wait = 0;
+    }
+
+    // 엣지 직전 값으로 핸드셰이크 판정
+    void sample() {
+        aw_hs = state == WR && *awvalid && *awready;
+        w_hs = state == WR && *wvalid && *wready;
+        b_hs = state == WR && aw_done && w_done && *bvalid;
+        ar_hs = state == RD && *arvalid && *arready;
+        r_hs = state == RD && ar_done && *rvalid;
+        r_data = *rdata;
+    }
+
+    // 엣지 후 입력 갱신
+    void update() {
+        completed = false;
+        if (state == IDLE) return;
+        if (++wait > TIMEOUT) {
+            printf("FAIL timeout port %s\n", state == WR ? "write" : "read");
+            exit(1);
+        }
+        if (aw_hs) { aw_done = true; *awvalid = 0; }
+        if (w_hs) { w_done = true; *wvalid = 0; }
+        if (b_hs) { *bready = 0; state = IDLE; completed = true; }
+        if (ar_hs) { ar_done = true; *arvalid = 0; }
+        if (r_hs) { *rready = 0; state = IDLE; result = r_data; completed = true; }
+    }
+};
+
+#define BIND_PORT(p) AxiPort{ &top->p##_awaddr, &top->p##_awvalid, &top->p##_awready, &top->p##_wdata, \
+    &top->p##_wstrb, &top->p##_wvalid, &top->p##_wready, &top->p##_bvalid, &top->p##_bready, \
+    &top->p##_araddr, &top->p##_arvalid, &top->p##_arready, &top->p##_rdata, &top->p##_rvalid, &top->p##_rready }
+
+static AxiPort port[2];
+
+static void tick() {
+    for (auto &p : port) p.sample();
+    top->s00_axi_aclk = 1;
+    top->eval();
+    cycles++;
+    top->s00_axi_aclk = 0;
+    for (auto &p : port) p.update();
+    top->eval();
+}
+
+// 순서대로 하는 확인용 (다른 포트는 쉼)
+static void bus_write(int n, uint32_t a, uint32_t d, uint8_t strb = 0xF) {
+    port[n].write(a, d, strb);
+    top->eval();
+    while (port[n].busy()) tick();
+}
+
+static uint32_t bus_read(int n, uint32_t a) {
+    port[n].read(a);
+    top->eval();
+    while (port[n].busy()) tick();
+    return port[n].result;
+}
+
+static void expect_read(int n, uint32_t a, uint32_t want, const char *what) {
+    uint32_t v = bus_read(n, a);
+    check(v == want, what, v, want);
+}
+
+// 세대 gen 의 i번째 값 (세대 0 = 리셋 직후 RAM 내용 0)
+static uint32_t pattern(uint32_t gen, int i) {
+    return gen ? (gen * 0x9E3779B1u) ^ ((uint32_t)i << 24) ^ (uint32_t)i : 0;
+}
+
+// 시퀀스 잠금 쓰는 쪽: 시퀀스 홀수 → 묶음 → 시퀀스 짝수 → 초인종
+struct SeqWriter {
+    uint32_t base;
+    uint32_t seq = 0;
+    int step = 0;
+    uint32_t updates = 0;
+
+    void issue(AxiPort &p) {
+        if (step == 0) p.write(base, ++seq);
+        else if (step <= PAYLOAD_WORDS) p.write(base + 4 * step, pattern((seq + 1) / 2, step - 1));
+        else if (step == PAYLOAD_WORDS + 1) p.write(base, ++seq);
+        else p.write(REG_DOORBELL, 1);
+    }
+
+    void done(AxiPort &) {
+        if (++step > PAYLOAD_WORDS + 2) {
+            step = 0;
+            updates++;
+        }
+    }
+};
+
+// 시퀀스 잠금 읽는 쪽: 시퀀스 → 묶음 → 시퀀스, 둘이 같고 짝수일 때만 채택
+struct SeqReader {
+    uint32_t base;
+    int step = 0;
+    uint32_t s0, last_seq = 0;
+    uint32_t buf[PAYLOAD_WORDS];
+    uint32_t ok = 0, retries = 0, torn = 0;
+
+    void issue(AxiPort &p) {
+        if (step <= PAYLOAD_WORDS) p.read(base + 4 * step);
+        else p.read(base);
+    }
+
+    void done(AxiPort &p) {
+        uint32_t v = p.result;
+        if (step == 0) {
+            s0 = v;
+            if (s0 & 1) { retries++; return; }     // 쓰는 중: 처음부터
+            step = 1;
+        } else if (step <= PAYLOAD_WORDS) {
+            buf[step - 1] = v;
+            step++;
+        } else {
+            step = 0;
+            if (v != s0) { retries++; return; }
+            if (s0 < last_seq) {
+                torn++;
+                printf("FAIL seq went back %u -> %u\n", last_seq, s0);
+            }
+            last_seq = s0;
+            for (int i = 0; i < PAYLOAD_WORDS; i++) {
+                if (buf[i] != pattern(s0 / 2, i)) {
+                    torn++;
+                    printf("FAIL torn read base 0x%03x seq %u word %d: 0x%08x want 0x%08x\n",
+                        base, s0, i, buf[i], pattern(s0 / 2, i));
+                    break;
+                }
+            }
+            ok++;
+        }
+    }
+};
+
+// 포트마다 자기 블록 쓰기 + 상대 블록 읽기를 섞음 (전송 사이에 0~3클럭 쉼)
+// 갱신 중에는 쓰기/읽기 반반, 갱신 사이에는 가끔만 새 갱신 시작 (계속 쓰면 읽는 쪽이 굶음)
+struct Core {
+    SeqWriter wr;
+    SeqReader rd;
+    int owner = -1;             // 진행 중인 전송 주인 (0 쓰기, 1 읽기)
+    unsigned gap = 0;
+
+    void cycle(AxiPort &p) {
+        if (p.completed && owner >= 0) {
+            if (owner == 0) wr.done(p); else rd.done(p);
+            owner = -1;
+            gap = rand() & 3;
+        }
+        if (p.busy()) return;
+        if (gap) { gap--; return; }
+        if (wr.step) owner = rand() & 1;
+        else owner = (rand() & 15) ? 1 : 0;
+        if (owner == 0) wr.issue(p); else rd.issue(p);
+    }
+};
+
+int main(int argc, char **argv) {
+    Verilated::commandArgs(argc, argv);
+    top = new Vmyip_mailbox;
+    port[0] = BIND_PORT(s00_axi);
+    port[1] = BIND_PORT(s01_axi);
+    top->s00_axi_awprot = 0;
+    top->s00_axi_arprot = 0;
+    top->s01_axi_awprot = 0;
+    top->s01_axi_arprot = 0;
+
+    top->s00_axi_aresetn = 0;
+    for (int i = 0; i < 16; i++) tick();
+    top->s00_axi_aresetn = 1;
+    for (int i = 0; i < 4; i++) tick();
+
+    // 1) 블록 주인 / strobe / INFO
+    expect_read(0, REG_INFO, 0x2000, "info port 0");
+    expect_read(1, REG_INFO, 0x2001, "info port 1");
+
+    bus_write(0, BLK0 + 4, 0x11223344);
+    expect_read(1, BLK0 + 4, 0x11223344, "port 1 reads blk0");
+    bus_write(1, BLK0 + 4, 0xDEADBEEF);             // 주인이 아님: 무시
+    expect_read(0, BLK0 + 4, 0x11223344, "port 1 write to blk0 ignored");
+    bus_write(1, BLK1 + 8, 0x55667788);
+    expect_read(0, BLK1 + 8, 0x55667788, "port 0 reads blk1");
+    bus_write(0, BLK1 + 8, 0);
+    expect_read(1, BLK1 + 8, 0x55667788, "port 0 write to blk1 ignored");
+    bus_write(0, BLK0 + 4, 0x0000AA00, 0x2);        // 바이트 1만
+    expect_read(1, BLK0 + 4, 0x1122AA44, "byte strobe");
+
+    // 2) 초인종: 허용 전에는 IRQ 비트만, 허용하면 인터럽트 출력
+    bus_write(0, REG_DOORBELL, 1);
+    check(top->mbox1_intr == 0, "intr masked", top->mbox1_intr, 0);
+    expect_read(0, REG_IRQ, 0, "ringer's own irq stays clear");
+    bus_write(1, REG_CTRL, 1);
+    check(top->mbox1_intr == 1, "intr after enable", top->mbox1_intr, 1);
+    check(top->mbox0_intr == 0, "other side quiet", top->mbox0_intr, 0);
+    expect_read(1, REG_IRQ, 1, "irq bit");
+    check(top->mbox1_intr == 0, "intr cleared by irq read", top->mbox1_intr, 0);
+    expect_read(1, REG_IRQ, 0, "irq clear");
+    bus_write(0, REG_CTRL, 1);
+    bus_write(1, REG_DOORBELL, 1);
+    check(top->mbox0_intr == 1, "reverse doorbell", top->mbox0_intr, 1);
+    bus_read(0, REG_IRQ);
+    bus_write(0, REG_CTRL, 0);
+    bus_write(1, REG_CTRL, 0);
+
+    // 블록을 세대 0 (모두 0) 으로
+    for (int i = 0; i <= PAYLOAD_WORDS; i++) {
+        bus_write(0, BLK0 + 4 * i, 0);
+        bus_write(1, BLK1 + 4 * i, 0);
+    }
+
+    // 3) 시퀀스 잠금 스트레스 (양방향 동시)
+    Core core[2];
+    core[0].wr.base = BLK0;
+    core[0].rd.base = BLK1;
+    core[1].wr.base = BLK1;
+    core[1].rd.base = BLK0;
+    srand(1);
+    uint64_t start = cycles;
+    while (cycles - start < STRESS_CYCLES) {
+        core[0].cycle(port[0]);
+        core[1].cycle(port[1]);
+        top->eval();
+        tick();
+    }
+    while (port[0].busy() || port[1].busy()) tick();
+
+    for (int n = 0; n < 2; n++) {
+        SeqReader &r = core[n].rd;
+        printf("port %d: wrote %u updates, read ok=%u retry=%u torn=%u\n",
+            n, core[n].wr.updates, r.ok, r.retries, r.torn);
+        check(r.torn == 0, "no torn reads", r.torn, 0);
+        check(r.ok > 1000, "reader made progress", r.ok, 1000);
+        check(r.retries > 0, "writer/reader overlap exercised", r.retries, 1);
+    }
+    expect_read(0, REG_IRQ, 1, "port 0 saw doorbells");
+    expect_read(1, REG_IRQ, 1, "port 1 saw doorbells");
+
+    printf("%s: %d/%d checks, %llu cycles\n", fails ? "FAIL" : "PASS", checks - fails, checks,
+        (unsigned long long)cycles);
+    delete top;
+    return fails ? 1 : 0;
+}
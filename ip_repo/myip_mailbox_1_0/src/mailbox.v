@@ -0,0 +1,42 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 코어 간 메일박스 블록
+// 쓰기 포트 1개 (블록 주인 코어), 비동기 읽기 포트 2개 (두 코어 모두)
+// 방향마다 쓰는 쪽이 하나뿐이라 쓰기 충돌이 없고, LUT RAM (RAM32M) 으로 합성됨
+// 여러 워드 묶음의 일관성은 소프트웨어 시퀀스 잠금 (블록 워드 0 = 시퀀스)
+//////////////////////////////////////////////////////////////////////////////////
+
+module mailbox_block #(
+    parameter AW = 5                 // 깊이 = 2^AW 워드
+)(
+    input clk,
+    input we,
+    input [3:0] wstrb,
+    input [AW-1:0] waddr,
+    input [31:0] wdata,
+    input [AW-1:0] raddr_a,
+    output [31:0] rdata_a,
+    input [AW-1:0] raddr_b,
+    output [31:0] rdata_b
+);
+
+    (* ram_style = "distributed" *) reg [31:0] mem [0:(1 << AW) - 1];
+
+    integer i;
+    initial begin
+        for (i = 0; i < (1 << AW); i = i + 1) mem[i] = 0;
+    end
+
+    always @(posedge clk) begin
+        if (we) begin
+            if (wstrb[0]) mem[waddr][7:0] <= wdata[7:0];
+            if (wstrb[1]) mem[waddr][15:8] <= wdata[15:8];
+            if (wstrb[2]) mem[waddr][23:16] <= wdata[23:16];
+            if (wstrb[3]) mem[waddr][31:24] <= wdata[31:24];
+        end
+    end
+
+    assign rdata_a = mem[raddr_a];
+    assign rdata_b = mem[raddr_b];
+
+endmodule
@@ -16,6 +16,12 @@
 #define MYIP_PWM_S00_AXI_SLV_REG6_OFFSET 24
 #define MYIP_PWM_S00_AXI_SLV_REG7_OFFSET 28
 
+/* REG3[0] = 1: 클럭 단위 모드 (REG0 = high 클럭 수, REG1 = 주기 클럭 수, 32비트) */
+#define MYIP_PWM_HIGH_TICKS_OFFSET  MYIP_PWM_S00_AXI_SLV_REG0_OFFSET
+#define MYIP_PWM_PERIOD_TICKS_OFFSET MYIP_PWM_S00_AXI_SLV_REG1_OFFSET
+#define MYIP_PWM_MODE_OFFSET        MYIP_PWM_S00_AXI_SLV_REG3_OFFSET
+#define MYIP_PWM_MODE_TICKS         (1 << 0)
+
 
 /**************************** Type Definitions *****************************/
 /**
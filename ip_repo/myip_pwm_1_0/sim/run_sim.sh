@@ -0,0 +1,23 @@
+#!/bin/sh
+# myip_pwm Verilator 테스트벤치 실행 (일반 리눅스 + verilator 5.x / 4.2xx)
+#   ./run_sim.sh
+# AXI 마스터 모델과 PWM 측정기는 ip_repo/sim 공통 헤더 사용
+set -e
+cd "$(dirname "$0")"
+
+COMMON=../../sim
+
+# src/*.v 전체는 다른 보드 모듈까지 섞여 있으므로 필요한 모듈만 뽑아서 컴파일
+{
+    sed -n '/^module pwm_ticks(/,/^endmodule/p' ../src/countre.v
+    sed -n '/^module pwm_Nfreq_Nstep_1(/,/^endmodule/p' ../src/countre.v
+    sed -n '/^module edge_detector_p(/,/^endmodule/p' ../src/test.v
+} > pwm_dut.v
+
+verilator --cc --exe --build -j 0 -O3 -Wno-fatal -Wno-lint -Wno-style \
+    --top-module myip_pwm -CFLAGS "-O2 -I$(pwd)/$COMMON" \
+    ../hdl/myip_pwm.v ../hdl/myip_pwm_slave_lite_v1_0_S00_AXI.v ../hdl/axil_slave_pipe.v pwm_dut.v \
+    tb_myip_pwm.cpp -o tb_myip_pwm
+
+./obj_dir/tb_myip_pwm | tee sim.log
+grep -q '^PASS' sim.log
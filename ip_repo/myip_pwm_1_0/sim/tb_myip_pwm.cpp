@@ -0,0 +1,184 @@
+// myip_pwm Verilator 테스트벤치
+// AXI-Lite로 레지스터를 쓰고 pwm 출력의 주기/high 길이를 수천 클럭 동안 측정해서
+// 아래 기준 모델과 비교 (기존 모드 duty/temp/duty_step 스윕 + 클럭 단위 모드 스윕)
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include "verilated.h"
+#include "Vmyip_pwm.h"
+#include "axi_lite_master.h"
+#include "pwm_meter.h"
+
+#define REG_DUTY        0x0     // 기존 모드: duty / 클럭 단위 모드: high 클럭 수
+#define REG_TEMP        0x4     // 기존 모드: temp / 클럭 단위 모드: 주기 클럭 수
+#define REG_DUTY_STEP   0x8
+#define REG_MODE        0xC     // [0] 1이면 클럭 단위 모드
+
+#define MEASURE_PERIODS 16      // 설정마다 측정할 주기 수
+#define TOL_CLK         1       // 허용 오차 (클럭)
+
+// 기준 모델 (클럭 단위)
+// 기존 모드: temp 클럭마다 토글 → 2*temp 클럭마다 duty 카운터 1 증가, 카운터는 0..duty_step
+struct PwmExpect {
+    uint64_t period;
+    uint64_t high;
+};
+
+static PwmExpect model_step(uint32_t duty, uint32_t temp, uint32_t step) {
+    uint64_t sub = 2ull * temp;
+    uint64_t n = (uint64_t)step + 1;
+    return { sub * n, sub * (duty < n ? duty : n) };
+}
+
+static PwmExpect model_ticks(uint32_t high, uint32_t period) {
+    return { period, high < period ? high : period };
+}
+
+static Vmyip_pwm *top;
+static AxiLiteMaster<Vmyip_pwm> *bus;
+static PwmMeter meter;
+static int fails, checks;
+
+static bool within(uint64_t v, uint64_t want) {
+    return v + TOL_CLK >= want && v <= want + TOL_CLK;
+}
+
+// 설정 후 2주기 버리고 MEASURE_PERIODS 주기 측정, 모델과 비교
+static void check(const char *name, PwmExpect e) {
+    bus->run(2 * e.period + 8);
+    meter.clear();
+    bus->run(MEASURE_PERIODS * e.period + 2);
+    checks++;
+
+    bool ok;
+    if (e.high == 0) ok = meter.always_low();
+    else if (e.high >= e.period) ok = meter.always_high();
+    else ok = meter.periods >= MEASURE_PERIODS - 1 &&
+              within(meter.period_min, e.period) && within(meter.period_max, e.period) &&
+              within(meter.high_min, e.high) && within(meter.high_max, e.high);
+
+    if (!ok) {
+        fails++;
+        std::printf("FAIL %-28s want period=%llu high=%llu, got %llu periods, period %llu..%llu high %llu..%llu (high %llu/%llu clk)\n",
+            name, (unsigned long long)e.period, (unsigned long long)e.high,
+            (unsigned long long)meter.periods,
+            (unsigned long long)meter.period_min, (unsigned long long)meter.period_max,
+            (unsigned long long)meter.high_min, (unsigned long long)meter.high_max,
+            (unsigned long long)meter.high_samples, (unsigned long long)meter.samples);
+    }
+}
+
+static void sweep_step_mode() {
+    static const uint32_t temps[] = { 1, 2, 5 };
+    static const uint32_t steps[] = { 9, 99, 255 };
+
+    bus->write(REG_MODE, 0);
+    for (uint32_t temp : temps) {
+        for (uint32_t step : steps) {
+            const uint32_t duties[] = { 0, 1, step / 2, step, step + 1, step + 100 };
+            bus->write(REG_TEMP, temp);
+            bus->write(REG_DUTY_STEP, step);
+            for (uint32_t duty : duties) {
+                char name[64];
+                std::snprintf(name, sizeof name, "step t=%u s=%u d=%u", temp, step, duty);
+                bus->write(REG_DUTY, duty);
+                check(name, model_step(duty, temp, step));
+            }
+        }
+    }
+}
+
+static void sweep_tick_mode() {
+    static const uint32_t periods[] = { 100, 1000, 5000 };
+
+    bus->write(REG_MODE, 1);
+    for (uint32_t period : periods) {
+        const uint32_t highs[] = { 0, 1, period / 4, period / 2, period - 1, period, period * 2 };
+        bus->write(REG_TEMP, period);
+        for (uint32_t high : highs) {
+            char name[64];
+            std::snprintf(name, sizeof name, "ticks p=%u h=%u", period, high);
+            bus->write(REG_DUTY, high);
+            check(name, model_ticks(high, period));
+        }
+    }
+}
+
+// 주기 중간에 duty를 바꿔도 이전 값 또는 새 값의 펄스만 나와야 함 (주기 경계 반영)
+static void check_no_runt() {
+    const uint32_t period = 1000, a = 300, b = 700;
+    uint64_t bad = 0, seen = 0;
+    uint64_t rise = 0, now = 0;
+    bool prev, have_rise = false;
+
+    bus->write(REG_MODE, 1);
+    bus->write(REG_TEMP, period);
+    bus->write(REG_DUTY, a);
+    bus->run(3 * period);
+
+    prev = top->pwm;
+    bus->on_cycle = [&] {
+        bool lv = top->pwm;
+        if (lv && !prev) {
+            rise = now;
+            have_rise = true;
+        }
+        if (!lv && prev && have_rise) {
+            uint64_t h = now - rise;
+            seen++;
+            if (!within(h, a) && !within(h, b)) bad++;
+        }
+        prev = lv;
+        now++;
+    };
+    for (uint32_t i = 0; i < 40; i++) {
+        bus->run(period * 2 + 37 * i);  // 주기 안의 여러 위치에서 쓰기
+        bus->write(REG_DUTY, (i & 1) ? a : b);
+    }
+    bus->run(2 * period);
+    bus->on_cycle = [] { meter.sample(top->pwm); };
+
+    checks++;
+    if (bad || seen < 40) {
+        fails++;
+        std::printf("FAIL runt check: %llu of %llu pulses had neither %u nor %u clocks\n",
+            (unsigned long long)bad, (unsigned long long)seen, a, b);
+    }
+}
+
+int main(int argc, char **argv) {
+    Verilated::commandArgs(argc, argv);
+    top = new Vmyip_pwm;
+    bus = new AxiLiteMaster<Vmyip_pwm>(top);
+    bus->on_cycle = [] { meter.sample(top->pwm); };
+
+    auto t0 = std::chrono::steady_clock::now();
+    bus->reset();
+
+    // 레지스터 읽기/쓰기 확인
+    bus->write(REG_DUTY_STEP, 0x12345678);
+    checks++;
+    if (bus->read(REG_DUTY_STEP) != 0x12345678) {
+        fails++;
+        std::printf("FAIL register readback\n");
+    }
+
+    sweep_step_mode();
+    sweep_tick_mode();
+    check_no_runt();
+
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("%llu cycles in %.2f s (%.2f Mcycles/s)\n",
+        (unsigned long long)bus->cycles, sec, bus->cycles / sec / 1e6);
+
+    top->final();
+    delete bus;
+    delete top;
+
+    if (fails) {
+        std::printf("FAILED %d of %d checks\n", fails, checks);
+        return 1;
+    }
+    std::printf("PASS %d checks\n", checks);
+    return 0;
+}
@@ -903,6 +903,43 @@ endmodule
 
 
 
+// 100MHz 클럭을 그대로 세는 PWM (분주 없음, 주기/high 시간을 클럭 수로 지정)
+// 50Hz 서보: period = 2,000,000, high = 50,000 ~ 250,000 (10ns 단위)
+module pwm_ticks(
+    input clk, reset_p,
+    input enable,                // 0이면 정지 (동기, 리셋 경로와 분리)
+    input [31:0] high_ticks,     // 한 주기 중 high 클럭 수
+    input [31:0] period_ticks,   // 주기 클럭 수 (0이면 정지)
+    output reg pwm
+);
+
+reg [31:0] cnt;
+reg [31:0] high_active;          // 주기 경계에서만 반영
+
+always @(posedge clk or posedge reset_p) begin
+    if (reset_p) begin
+        cnt <= 0;
+        high_active <= 0;
+        pwm <= 0;
+    end
+    else if (!enable || period_ticks == 0) begin
+        cnt <= 0;
+        high_active <= high_ticks;
+        pwm <= 0;
+    end
+    else begin
+        if (cnt >= period_ticks - 1) begin
+            cnt <= 0;
+            high_active <= high_ticks;
+        end
+        else cnt <= cnt + 1;
+
+        pwm <= (cnt < high_active);
+    end
+end
+
+endmodule
+
 module pwm_Nfreq_Nstep_1(
     input clk, reset_p,
     input [31:0] duty,       // 듀티
@@ -936,19 +973,24 @@ edge_detector_p pwm_freqN_edge(
     .n_edge(pwm_freqN_negedge)
 );
 
+// duty는 주기가 끝날 때만 반영 (주기 중간에 써도 짧은/늘어난 펄스가 나오지 않음)
 integer cnt_duty;
+reg [31:0] duty_active;
 always @(posedge clk or posedge reset_p) begin
     if (reset_p) begin
         cnt_duty <= 0;
+        duty_active <= 0;
         pwm <= 0;
     end
     else if (pwm_freqN_negedge) begin
-        if(cnt_duty >= duty_step_reg) 
+        if(cnt_duty >= duty_step_reg) begin
             cnt_duty <= 0;
+            duty_active <= duty;
+        end
         else 
             cnt_duty <= cnt_duty + 1;
 
-        if (cnt_duty < duty)
+        if (cnt_duty < duty_active)
             pwm <= 1;
         else
             pwm <= 0;
@@ -938,19 +938,24 @@ edge_detector_p pwm_freqN_edge(
     .n_edge(pwm_freqN_negedge)
 );
 
+// duty는 주기가 끝날 때만 반영 (주기 중간에 써도 짧은/늘어난 펄스가 나오지 않음)
 integer cnt_duty;
+reg [31:0] duty_active;
 always @(posedge clk or posedge reset_p) begin
     if (reset_p) begin
         cnt_duty <= 0;
+        duty_active <= 0;
         pwm <= 0;
     end
     else if (pwm_freqN_negedge) begin
-        if(cnt_duty >= duty_step_reg) 
+        if(cnt_duty >= duty_step_reg) begin
             cnt_duty <= 0;
+            duty_active <= duty;
+        end
         else 
             cnt_duty <= cnt_duty + 1;
 
-        if (cnt_duty < duty)
+        if (cnt_duty < duty_active)
             pwm <= 1;
         else
             pwm <= 0;
@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_pwm_multi.h"
+
+/************************** Function Definitions ***************************/
@@ -0,0 +1,93 @@
+
+#ifndef MYIP_PWM_MULTI_H
+#define MYIP_PWM_MULTI_H
+
+
+/****************** Include Files ********************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define MYIP_PWM_MULTI_CTRL_OFFSET          0x00    /* [0] 전체 출력 허용, [1] 동기 모드 */
+#define MYIP_PWM_MULTI_CH_EN_OFFSET         0x04    /* [N-1:0] 채널 출력 허용 */
+#define MYIP_PWM_MULTI_TB_SEL_OFFSET        0x08    /* [N-1:0] 1이면 타임베이스1 */
+#define MYIP_PWM_MULTI_INFO_OFFSET          0x0C    /* 읽기: [7:0] 채널 수, [8] commit 대기 (동작 중인 타임베이스만) */
+#define MYIP_PWM_MULTI_COMMIT_OFFSET        0x0C    /* 쓰기: 섀도 duty를 다음 주기 경계에서 일괄 반영 */
+#define MYIP_PWM_MULTI_TB0_PRESCALE_OFFSET  0x10    /* 틱 = PRESCALE+1 클럭 */
+#define MYIP_PWM_MULTI_TB0_PERIOD_OFFSET    0x14    /* 주기 = PERIOD 틱 */
+#define MYIP_PWM_MULTI_TB1_PRESCALE_OFFSET  0x18
+#define MYIP_PWM_MULTI_TB1_PERIOD_OFFSET    0x1C
+#define MYIP_PWM_MULTI_DUTY_OFFSET(n)       (0x20 + (n) * 4)    /* high 틱 수 목표값 (섀도) */
+#define MYIP_PWM_MULTI_RATE_OFFSET(n)       (0x80 + (n) * 4)    /* 주기당 최대 변화 틱, 0=제한 없음 */
+#define MYIP_PWM_MULTI_STATUS_OFFSET        0xE0    /* 읽기 전용 [N-1:0] 목표값 도달 */
+#define MYIP_PWM_MULTI_ALIGN_OFFSET         0xE4    /* [N-1:0] 1이면 센터 정렬 */
+#define MYIP_PWM_MULTI_PHASE_OFFSET(n)      (0x100 + (n) * 4)   /* 펄스 시작 틱 (주기보다 작게) */
+
+#define MYIP_PWM_MULTI_CTRL_ENABLE          (1 << 0)
+#define MYIP_PWM_MULTI_CTRL_SYNC            (1 << 1)
+#define MYIP_PWM_MULTI_INFO_PENDING         (1 << 8)
+
+
+/**************************** Type Definitions *****************************/
+/**
+ *
+ * Write a value to a MYIP_PWM_MULTI register. A 32 bit write is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is written.
+ *
+ * @param   BaseAddress is the base address of the MYIP_PWM_MULTIdevice.
+ * @param   RegOffset is the register offset from the base to write to.
+ * @param   Data is the data written to the register.
+ *
+ * @return  None.
+ *
+ * @note
+ * C-style signature:
+ * 	void MYIP_PWM_MULTI_mWriteReg(u32 BaseAddress, unsigned RegOffset, u32 Data)
+ *
+ */
+#define MYIP_PWM_MULTI_mWriteReg(BaseAddress, RegOffset, Data) \
+  	Xil_Out32((BaseAddress) + (RegOffset), (u32)(Data))
+
+/**
+ *
+ * Read a value from a MYIP_PWM_MULTI register. A 32 bit read is performed.
+ * If the component is implemented in a smaller width, only the least
+ * significant data is read from the register. The most significant data
+ * will be read as 0.
+ *
+ * @param   BaseAddress is the base address of the MYIP_PWM_MULTI device.
+ * @param   RegOffset is the register offset from the base to write to.
+ *
+ * @return  Data is the data from the register.
+ *
+ * @note
+ * C-style signature:
+ * 	u32 MYIP_PWM_MULTI_mReadReg(u32 BaseAddress, unsigned RegOffset)
+ *
+ */
+#define MYIP_PWM_MULTI_mReadReg(BaseAddress, RegOffset) \
+    Xil_In32((BaseAddress) + (RegOffset))
+
+/************************** Function Prototypes ****************************/
+/**
+ *
+ * Run a self-test on the driver/device. Note this may be a destructive test if
+ * resets of the device are performed.
+ *
+ * If the hardware system is not built correctly, this function may never
+ * return to the caller.
+ *
+ * @param   baseaddr_p is the base address of the MYIP_PWM_MULTI instance to be worked on.
+ *
+ * @return
+ *
+ *    - XST_SUCCESS   if all self-test code passed
+ *    - XST_FAILURE   if any self-test code failed
+ *
+ * @note    Caching must be turned off for this function to work.
+ * @note    Self test may fail if data memory and device are not on the same bus.
+ *
+ */
+XStatus MYIP_PWM_MULTI_Reg_SelfTest(void * baseaddr_p);
+
+#endif // MYIP_PWM_MULTI_H
@@ -0,0 +1,308 @@
+
+`timescale 1 ns / 1 ps
+
+	module myip_pwm_multi_slave_lite_v1_0_S00_AXI #
+	(
+		// Users to add parameters here
+		parameter integer C_NUM_CHANNELS	= 8,   // 채널 수 (최대 24)
+		parameter integer C_ESTOP_MASK	= 48,  // estop 때 끌 채널 비트 (기본 4, 5 = 바퀴)
+		// User parameters ends
+		// Do not modify the parameters beyond this line
+
+		// Width of S_AXI data bus
+		parameter integer C_S_AXI_DATA_WIDTH	= 32,
+		// Width of S_AXI address bus
+		parameter integer C_S_AXI_ADDR_WIDTH	= 9
+	)
+	(
+		// Users to add ports here
+output [C_NUM_CHANNELS-1:0] pwm,
+        input wire [127:0] map_duty,    // 채널 0~3 외부 목표 (관절 서보, 축 매핑 IP)
+        input wire [3:0] map_sel,       // 1인 채널은 map_duty가 섀도 값, 매 주기 경계에 반영
+        input wire estop,               // myip_estop: 1이면 C_ESTOP_MASK 채널 출력 0
+		// User ports ends
+		// Do not modify the ports beyond this line
+
+		// Global Clock Signal
+		input wire  S_AXI_ACLK,
+		// Global Reset Signal. This Signal is Active LOW
+		input wire  S_AXI_ARESETN,
+		// Write address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+		// Write channel Protection type. This signal indicates the
+    		// privilege and security level of the transaction, and whether
+    		// the transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_AWPROT,
+		// Write address valid. This signal indicates that the master signaling
+    		// valid write address and control information.
+		input wire  S_AXI_AWVALID,
+		// Write address ready. This signal indicates that the slave is ready
+    		// to accept an address and associated control signals.
+		output wire  S_AXI_AWREADY,
+		// Write data (issued by master, acceped by Slave) 
+		input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+		// Write strobes. This signal indicates which byte lanes hold
+    		// valid data. There is one write strobe bit for each eight
+    		// bits of the write data bus.    
+		input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+		// Write valid. This signal indicates that valid write
+    		// data and strobes are available.
+		input wire  S_AXI_WVALID,
+		// Write ready. This signal indicates that the slave
+    		// can accept the write data.
+		output wire  S_AXI_WREADY,
+		// Write response. This signal indicates the status
+    		// of the write transaction.
+		output wire [1 : 0] S_AXI_BRESP,
+		// Write response valid. This signal indicates that the channel
+    		// is signaling a valid write response.
+		output wire  S_AXI_BVALID,
+		// Response ready. This signal indicates that the master
+    		// can accept a write response.
+		input wire  S_AXI_BREADY,
+		// Read address (issued by master, acceped by Slave)
+		input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+		// Protection type. This signal indicates the privilege
+    		// and security level of the transaction, and whether the
+    		// transaction is a data access or an instruction access.
+		input wire [2 : 0] S_AXI_ARPROT,
+		// Read address valid. This signal indicates that the channel
+    		// is signaling valid read address and control information.
+		input wire  S_AXI_ARVALID,
+		// Read address ready. This signal indicates that the slave is
+    		// ready to accept an address and associated control signals.
+		output wire  S_AXI_ARREADY,
+		// Read data (issued by slave)
+		output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+		// Read response. This signal indicates the status of the
+    		// read transfer.
+		output wire [1 : 0] S_AXI_RRESP,
+		// Read valid. This signal indicates that the channel is
+    		// signaling the required read data.
+		output wire  S_AXI_RVALID,
+		// Read ready. This signal indicates that the master can
+    		// accept the read data and response information.
+		input wire  S_AXI_RREADY
+	);
+
+	// Example-specific design signals
+	// local parameter for addressing 32 bit / 64 bit C_S_AXI_DATA_WIDTH
+	// ADDR_LSB is used for addressing 32/64 bit registers/memories
+	// ADDR_LSB = 2 for 32 bits (n downto 2)
+	// ADDR_LSB = 3 for 64 bits (n downto 3)
+	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+	localparam integer OPT_MEM_ADDR_BITS = 6;
+	//----------------------------------------------
+	//-- Signals for user logic register space example
+	//------------------------------------------------
+	//-- Number of Slave Registers 128
+	// 0x00 CTRL      [0] 전체 출력 허용, [1] 동기 모드 (COMMIT 쓸 때만 duty 반영)
+	// 0x04 CH_EN     [N-1:0] 채널별 출력 허용
+	// 0x08 TB_SEL    [N-1:0] 0=타임베이스0, 1=타임베이스1
+	// 0x0C INFO      읽기: [7:0] 채널 수, [8] commit 대기 중 (동작 중인 타임베이스만) / 쓰기: COMMIT
+	// 0x10 TB0_PRESCALE / 0x14 TB0_PERIOD : 틱 = (PRESCALE+1) 클럭, 주기 = PERIOD 틱
+	// 0x18 TB1_PRESCALE / 0x1C TB1_PERIOD
+	// 0x20 + 4n DUTY[n] : 한 주기 중 high 틱 수 = 목표값 (주기 경계에서 반영)
+	// 0x80 + 4n RATE[n] : 주기당 최대 변화 틱 수 (0이면 제한 없음)
+	// 0xE0 STATUS       (읽기 전용) [N-1:0] 목표값 도달
+	// 0xE4 ALIGN     [N-1:0] 1이면 센터 정렬 (펄스 가운데 = PHASE + 주기/2)
+	// 0x100 + 4n PHASE[n] : 펄스 시작 틱 (주기보다 작게, 주기 경계에서 반영)
+	localparam integer REG_CTRL = 0, REG_CH_EN = 1, REG_TB_SEL = 2, REG_INFO = 3,
+	                   REG_TB0_PRE = 4, REG_TB0_PER = 5, REG_TB1_PRE = 6, REG_TB1_PER = 7,
+	                   REG_DUTY = 8, REG_RATE = 32, REG_STATUS = 56, REG_ALIGN = 57, REG_PHASE = 64;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	ctrl_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	ch_en_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	tb_sel_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	tb0_pre_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	tb0_per_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	tb1_pre_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	tb1_per_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	align_reg;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	duty_reg [0:C_NUM_CHANNELS-1];
+	reg [C_S_AXI_DATA_WIDTH-1:0]	rate_reg [0:C_NUM_CHANNELS-1];
+	reg [C_S_AXI_DATA_WIDTH-1:0]	phase_reg [0:C_NUM_CHANNELS-1];
+	integer	 ch;
+	integer	 byte_index;
+
+	// AXI4-Lite 인터페이스: 매 클럭 쓰기 1개 + 읽기 1개 수락 (원본 common/hdl/axil_slave_pipe.v)
+	wire  wr_en;
+	wire [OPT_MEM_ADDR_BITS:0] wr_idx;
+	wire  rd_en;
+	wire [OPT_MEM_ADDR_BITS:0] rd_idx;
+	reg [C_S_AXI_DATA_WIDTH-1:0] rd_data;
+
+	axil_slave_pipe # ( 
+		.C_S_AXI_DATA_WIDTH(C_S_AXI_DATA_WIDTH),
+		.C_S_AXI_ADDR_WIDTH(C_S_AXI_ADDR_WIDTH)
+	) axil_if (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(),
+		.wr_strb(),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(rd_data),
+		.S_AXI_ACLK(S_AXI_ACLK),
+		.S_AXI_ARESETN(S_AXI_ARESETN),
+		.S_AXI_AWADDR(S_AXI_AWADDR),
+		.S_AXI_AWPROT(S_AXI_AWPROT),
+		.S_AXI_AWVALID(S_AXI_AWVALID),
+		.S_AXI_AWREADY(S_AXI_AWREADY),
+		.S_AXI_WDATA(S_AXI_WDATA),
+		.S_AXI_WSTRB(S_AXI_WSTRB),
+		.S_AXI_WVALID(S_AXI_WVALID),
+		.S_AXI_WREADY(S_AXI_WREADY),
+		.S_AXI_BRESP(S_AXI_BRESP),
+		.S_AXI_BVALID(S_AXI_BVALID),
+		.S_AXI_BREADY(S_AXI_BREADY),
+		.S_AXI_ARADDR(S_AXI_ARADDR),
+		.S_AXI_ARPROT(S_AXI_ARPROT),
+		.S_AXI_ARVALID(S_AXI_ARVALID),
+		.S_AXI_ARREADY(S_AXI_ARREADY),
+		.S_AXI_RDATA(S_AXI_RDATA),
+		.S_AXI_RRESP(S_AXI_RRESP),
+		.S_AXI_RVALID(S_AXI_RVALID),
+		.S_AXI_RREADY(S_AXI_RREADY)
+	);
+
+	// Implement memory mapped register select and write logic generation
+	// wr_en: AW/W를 수락한 클럭, wr_idx: 그때의 레지스터 번호
+	 
+
+	always @( posedge S_AXI_ACLK )
+	begin
+	  if ( S_AXI_ARESETN == 1'b0 )
+	    begin
+	      ctrl_reg <= 0;
+	      ch_en_reg <= 0;
+	      tb_sel_reg <= 0;
+	      tb0_pre_reg <= 0;
+	      tb0_per_reg <= 0;
+	      tb1_pre_reg <= 0;
+	      tb1_per_reg <= 0;
+	      align_reg <= 0;
+	      for ( ch = 0; ch < C_NUM_CHANNELS; ch = ch+1 ) begin
+	        duty_reg[ch] <= 0;
+	        rate_reg[ch] <= 0;
+	        phase_reg[ch] <= 0;
+	      end
+	    end 
+	  else begin
+	    if (wr_en)
+	      begin
+	        for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	          if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	            // Respective byte enables are asserted as per write strobes 
+	            case ( wr_idx )
+	              REG_CTRL:    ctrl_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_CH_EN:   ch_en_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_TB_SEL:  tb_sel_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_INFO:    ;   // COMMIT (아래에서 처리)
+	              REG_TB0_PRE: tb0_pre_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_TB0_PER: tb0_per_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_TB1_PRE: tb1_pre_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_TB1_PER: tb1_per_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              REG_ALIGN:   align_reg[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              default:
+	                // 채널 레지스터 파일 (범위 밖 주소는 무시)
+	                if ( wr_idx >= REG_DUTY && wr_idx < REG_DUTY + C_NUM_CHANNELS )
+	                  duty_reg[wr_idx - REG_DUTY][(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	                else if ( wr_idx >= REG_RATE && wr_idx < REG_RATE + C_NUM_CHANNELS )
+	                  rate_reg[wr_idx - REG_RATE][(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	                else if ( wr_idx >= REG_PHASE && wr_idx < REG_PHASE + C_NUM_CHANNELS )
+	                  phase_reg[wr_idx - REG_PHASE][(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	            endcase
+	          end  
+	      end
+	  end
+	end    
+
+	// Implement memory mapped register select and read logic generation
+	localparam [7:0] NUM_CH = C_NUM_CHANNELS;
+	wire commit_pending;
+	wire [C_NUM_CHANNELS-1:0] at_target;
+
+	always @(*) begin
+	  case ( rd_idx )
+	    REG_CTRL:    rd_data = ctrl_reg;
+	    REG_CH_EN:   rd_data = ch_en_reg;
+	    REG_TB_SEL:  rd_data = tb_sel_reg;
+	    REG_INFO:    rd_data = {23'd0, commit_pending, NUM_CH};
+	    REG_TB0_PRE: rd_data = tb0_pre_reg;
+	    REG_TB0_PER: rd_data = tb0_per_reg;
+	    REG_TB1_PRE: rd_data = tb1_pre_reg;
+	    REG_TB1_PER: rd_data = tb1_per_reg;
+	    REG_ALIGN:   rd_data = align_reg;
+	    default:
+	      if ( rd_idx >= REG_DUTY && rd_idx < REG_DUTY + C_NUM_CHANNELS )
+	        rd_data = duty_reg[rd_idx - REG_DUTY];
+	      else if ( rd_idx >= REG_RATE && rd_idx < REG_RATE + C_NUM_CHANNELS )
+	        rd_data = rate_reg[rd_idx - REG_RATE];
+	      else if ( rd_idx >= REG_PHASE && rd_idx < REG_PHASE + C_NUM_CHANNELS )
+	        rd_data = phase_reg[rd_idx - REG_PHASE];
+	      else if ( rd_idx == REG_STATUS )
+	        rd_data = at_target;
+	      else
+	        rd_data = 0;
+	  endcase
+	end
+	// Add user logic here
+	// COMMIT: 0x0C에 쓰면 1클럭 펄스
+	wire commit_wr = wr_en && (wr_idx == REG_INFO);
+
+	// 카운터/비교기 폭: 32비트라 프리스케일 0 (10ns 틱)으로도 서보 20ms 주기를 그대로 셈
+	localparam integer PWM_W = 32;
+	// 채널 duty를 한 버스로 묶어서 코어로 (채널 n = [n*W +: W])
+	wire [C_NUM_CHANNELS*PWM_W-1:0] duty_bus;
+	wire [C_NUM_CHANNELS*PWM_W-1:0] rate_bus;
+	wire [C_NUM_CHANNELS*PWM_W-1:0] phase_bus;
+	wire [C_NUM_CHANNELS-1:0] live_bus;
+	wire [C_NUM_CHANNELS-1:0] pwm_raw;
+	genvar gi;
+	generate
+	  for ( gi = 0; gi < C_NUM_CHANNELS; gi = gi+1 ) begin : g_duty
+	    if ( gi < 4 ) begin : g_map
+	      // 매핑 입력을 쓰는 채널은 펌웨어 DUTY를 무시 (펌웨어가 map_sel을 내리면 다시 DUTY)
+	      assign duty_bus[gi*PWM_W +: PWM_W] = map_sel[gi] ? map_duty[gi*32 +: PWM_W] : duty_reg[gi][PWM_W-1:0];
+	      assign live_bus[gi] = map_sel[gi];
+	    end
+	    else begin : g_reg
+	      assign duty_bus[gi*PWM_W +: PWM_W] = duty_reg[gi][PWM_W-1:0];
+	      assign live_bus[gi] = 1'b0;
+	    end
+	    assign rate_bus[gi*PWM_W +: PWM_W] = rate_reg[gi][PWM_W-1:0];
+	    assign phase_bus[gi*PWM_W +: PWM_W] = phase_reg[gi][PWM_W-1:0];
+	  end
+	endgenerate
+
+pwm_multi_core #(
+    .N(C_NUM_CHANNELS),
+    .W(PWM_W)
+) pwm_core (
+    .clk(S_AXI_ACLK),
+    .reset_p(~S_AXI_ARESETN),
+    .enable(ctrl_reg[0]),
+    .ch_en(ch_en_reg[C_NUM_CHANNELS-1:0]),
+    .tb_sel(tb_sel_reg[C_NUM_CHANNELS-1:0]),
+    .tb0_prescale(tb0_pre_reg[15:0]),
+    .tb0_period(tb0_per_reg[PWM_W-1:0]),
+    .tb1_prescale(tb1_pre_reg[15:0]),
+    .tb1_period(tb1_per_reg[PWM_W-1:0]),
+    .duty(duty_bus),
+    .sync_mode(ctrl_reg[1]),
+    .commit(commit_wr),
+    .live(live_bus),
+    .rate(rate_bus),
+    .phase(phase_bus),
+    .center(align_reg[C_NUM_CHANNELS-1:0]),
+    .commit_pending(commit_pending),
+    .at_target(at_target),
+    .pwm(pwm_raw)
+);
+
+    // 비상정지: 카운터/슬루 상태는 그대로 두고 핀만 끔
+    localparam [23:0] ESTOP_MASK = C_ESTOP_MASK;
+    assign pwm = pwm_raw & ~({C_NUM_CHANNELS{estop}} & ESTOP_MASK[C_NUM_CHANNELS-1:0]);
+	// User logic ends
+
+	endmodule
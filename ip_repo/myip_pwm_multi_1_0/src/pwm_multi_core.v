@@ -0,0 +1,174 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// N채널 PWM 코어 (기본 32비트 카운터: 프리스케일 0이면 클럭 해상도)
+// 채널마다 카운터를 두지 않고 타임베이스 2개를 공유, 채널은 비교기만 가짐
+// (서보 50Hz와 DC모터 PWM처럼 주기가 다른 그룹을 한 IP에서 같이 쓰기 위해 2개)
+// duty는 섀도 레지스터 → 주기 경계에서 목표값으로 반영
+// 실제 비교값은 목표값을 향해 주기마다 최대 rate 틱씩 이동 (서보 슬루 제한)
+// 펄스 위치는 채널별 phase(+센터 정렬)로 옮김: 같은 타임베이스 채널이 한 엣지에 몰리지 않게
+//////////////////////////////////////////////////////////////////////////////////
+
+// 프리스케일러 + 주기 카운터
+module pwm_timebase #(
+    parameter W = 32
+)(
+    input clk,
+    input reset_p,
+    input enable,
+    input [15:0] prescale,       // 틱 = prescale+1 클럭
+    input [W-1:0] period,        // 한 주기 틱 수 (0이면 정지)
+    output reg [W-1:0] cnt,
+    output rollover              // 다음 클럭부터 새 주기 (1클럭 펄스)
+);
+
+    reg [15:0] pre_cnt;
+
+    assign rollover = enable && period != 0 && pre_cnt >= prescale && cnt >= period - 1;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            pre_cnt <= 0;
+            cnt <= 0;
+        end
+        else if (!enable || period == 0) begin
+            pre_cnt <= 0;
+            cnt <= 0;
+        end
+        else if (pre_cnt >= prescale) begin
+            pre_cnt <= 0;
+            if (cnt >= period - 1) cnt <= 0;
+            else cnt <= cnt + 1;
+        end
+        else pre_cnt <= pre_cnt + 1;
+    end
+
+endmodule
+
+module pwm_multi_core #(
+    parameter N = 8,
+    parameter W = 32
+)(
+    input clk,
+    input reset_p,
+    input enable,                // 전체 출력 허용
+    input [N-1:0] ch_en,         // 채널별 출력 허용
+    input [N-1:0] tb_sel,        // 채널별 타임베이스 선택
+    input [15:0] tb0_prescale,
+    input [W-1:0] tb0_period,
+    input [15:0] tb1_prescale,
+    input [W-1:0] tb1_period,
+    input [N*W-1:0] duty,        // 채널 n = duty[n*W +: W], high 틱 수 (섀도)
+    input sync_mode,             // 1: commit 전까지 섀도 값을 반영하지 않음
+    input commit,                // 1클럭 펄스: 모든 채널을 다음 주기 경계에서 같이 반영
+    input [N-1:0] live,          // 1인 채널은 동기 모드에서도 매 주기 경계에 섀도 반영 (외부 매핑 입력)
+    input [N*W-1:0] rate,        // 채널 n 주기당 최대 변화량 (0이면 바로 목표값)
+    input [N*W-1:0] phase,       // 채널 n 펄스 시작 틱 (주기보다 작게)
+    input [N-1:0] center,        // 채널별 센터 정렬 (펄스 가운데 = phase + 주기/2)
+    output commit_pending,
+    output [N-1:0] at_target,    // 실제 비교값이 목표값에 도달
+    output [N-1:0] pwm
+);
+
+    wire [W-1:0] cnt0, cnt1;
+    wire roll0, roll1;
+
+    pwm_timebase #(.W(W)) tb0 (
+        .clk(clk), .reset_p(reset_p), .enable(enable),
+        .prescale(tb0_prescale), .period(tb0_period), .cnt(cnt0), .rollover(roll0)
+    );
+
+    pwm_timebase #(.W(W)) tb1 (
+        .clk(clk), .reset_p(reset_p), .enable(enable),
+        .prescale(tb1_prescale), .period(tb1_period), .cnt(cnt1), .rollover(roll1)
+    );
+
+    // commit 요청은 타임베이스별로 그 주기 경계까지 유지
+    // 멈춘 타임베이스(period 0)는 경계가 오지 않으므로 대기하지 않음 (한쪽만 쓰면 pending 이 남지 않게)
+    reg pend0, pend1;
+    wire run0 = enable && tb0_period != 0;
+    wire run1 = enable && tb1_period != 0;
+    assign commit_pending = pend0 | pend1;
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            pend0 <= 0;
+            pend1 <= 0;
+        end
+        else begin
+            pend0 <= run0 & (commit | (pend0 & ~roll0));
+            pend1 <= run1 & (commit | (pend1 & ~roll1));
+        end
+    end
+
+    // 펄스 구간 시작점: phase, 센터 정렬이면 (주기 - duty)/2 를 더하고 주기 안으로 접음
+    function [W-1:0] win_start;
+        input [W-1:0] per;
+        input [W-1:0] ph;
+        input [W-1:0] d;
+        input ctr;
+        reg [W:0] sum;
+        begin
+            sum = ph + ((ctr && d < per) ? (per - d) >> 1 : 0);
+            win_start = (sum >= per) ? sum - per : sum;
+        end
+    endfunction
+
+    // 채널별 목표값 / 실제 비교값
+    // 정지 중에는 바로 반영, 동작 중에는 자기 타임베이스의 주기 경계에서만 갱신
+    genvar g;
+    generate
+        for (g = 0; g < N; g = g + 1) begin : g_ch
+            reg [W-1:0] duty_target;
+            reg [W-1:0] duty_active;
+            reg [W-1:0] start;
+            reg pwm_r;
+
+            wire roll = tb_sel[g] ? roll1 : roll0;
+            wire pend = tb_sel[g] ? pend1 : pend0;
+            wire [W-1:0] shadow = duty[g*W +: W];
+            wire [W-1:0] step = rate[g*W +: W];
+            wire [W-1:0] per = tb_sel[g] ? tb1_period : tb0_period;
+            wire [W-1:0] cnt = tb_sel[g] ? cnt1 : cnt0;
+            wire [W-1:0] ph = phase[g*W +: W];
+
+            // 이번 경계에서 섀도를 받으면 그 값을 향해 바로 이동 시작
+            wire load = !sync_mode || pend || live[g];
+            wire [W-1:0] next_target = load ? shadow : duty_target;
+            wire [W-1:0] dist_up = next_target - duty_active;
+            wire [W-1:0] dist_dn = duty_active - next_target;
+            wire [W-1:0] next_active = (step == 0) ? next_target :
+                                       (next_target > duty_active) ? ((dist_up > step) ? duty_active + step : next_target) :
+                                       ((dist_dn > step) ? duty_active - step : next_target);
+
+            // 시작점 기준으로 돌린 카운터
+            wire [W-1:0] cnt_shift = (cnt >= start) ? cnt - start : cnt + per - start;
+
+            always @(posedge clk or posedge reset_p) begin
+                if (reset_p) begin
+                    duty_target <= 0;
+                    duty_active <= 0;
+                    start <= 0;
+                    pwm_r <= 0;
+                end
+                else begin
+                    pwm_r <= enable && ch_en[g] && (cnt_shift < duty_active);
+
+                    if (!enable) begin
+                        duty_target <= shadow;
+                        duty_active <= shadow;
+                        start <= win_start(per, ph, shadow, center[g]);
+                    end
+                    else if (roll) begin
+                        duty_target <= next_target;
+                        duty_active <= next_active;
+                        start <= win_start(per, ph, next_active, center[g]);
+                    end
+                end
+            end
+
+            assign pwm[g] = pwm_r;
+            assign at_target[g] = (duty_active == duty_target);
+        end
+    endgenerate
+
+endmodule
@@ -0,0 +1,6 @@
+
+
+/***************************** Include Files *******************************/
+#include "myip_servo_fb.h"
+
+/************************** Function Definitions ***************************/
@@ -0,0 +1,14 @@
+/* myip_servo_fb 레지스터 맵 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것) */
+#ifndef MYIP_SERVO_FB_REGS_H
+#define MYIP_SERVO_FB_REGS_H
+
+#define MYIP_SERVO_FB_CTRL_OFFSET            0x00    /* [0] 동작 (0이면 XADC 리셋 상태) */
+#define MYIP_SERVO_FB_SEQ_OFFSET             0x04    /* 끝난 변환 시퀀스 수 (멈추면 값이 오래된 것) */
+#define MYIP_SERVO_FB_JOINT0_OFFSET          0x10    /* [11:0] 포텐셔미터 값 (16회 평균), [31] 변환된 적 있음 */
+#define MYIP_SERVO_FB_JOINT1_OFFSET          0x14
+#define MYIP_SERVO_FB_JOINT2_OFFSET          0x18
+#define MYIP_SERVO_FB_JOINT3_OFFSET          0x1C
+#define MYIP_SERVO_FB_CTRL_ENABLE            (1u << 0)
+#define MYIP_SERVO_FB_JOINT0_VALID           (1u << 31)
+
+#endif
@@ -0,0 +1,68 @@
+`timescale 1 ns / 1 ps
+// myip_servo_fb 레지스터 파일 - common/regmap.py 가 regmap.json 에서 생성 (직접 수정하지 말 것)
+// 0x00 CTRL       rw  [0] 동작 (0이면 XADC 리셋 상태)
+// 0x04 SEQ        ro  끝난 변환 시퀀스 수 (멈추면 값이 오래된 것)
+// 0x10 JOINT0     ro  [11:0] 포텐셔미터 값 (16회 평균), [31] 변환된 적 있음
+// 0x14 JOINT1     ro
+// 0x18 JOINT2     ro
+// 0x1C JOINT3     ro
+
+module myip_servo_fb_regs #
+(
+	parameter integer C_S_AXI_DATA_WIDTH	= 32
+)
+(
+	input wire  clk,
+	input wire  resetn,
+	input wire  wr_en,
+	input wire [3 : 0] wr_idx,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] wr_data,
+	input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] wr_strb,
+	input wire  rd_en,
+	input wire [3 : 0] rd_idx,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] ctrl,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] seq,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] joint0,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] joint1,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] joint2,
+	input wire [C_S_AXI_DATA_WIDTH-1 : 0] joint3,
+	output reg [C_S_AXI_DATA_WIDTH-1 : 0] rd_data
+);
+
+	localparam [3:0] IDX_CTRL = 0;
+	localparam [3:0] IDX_SEQ = 1;
+	localparam [3:0] IDX_JOINT0 = 4;
+	localparam [3:0] IDX_JOINT1 = 5;
+	localparam [3:0] IDX_JOINT2 = 6;
+	localparam [3:0] IDX_JOINT3 = 7;
+
+	integer	 byte_index;
+
+	always @( posedge clk )
+	begin
+	  if ( resetn == 1'b0 )
+	    begin
+	      ctrl <= 0;
+	    end
+	  else if ( wr_en )
+	    for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] == 1 )
+	        case ( wr_idx )
+	          IDX_CTRL: ctrl[(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+	          default: ;
+	        endcase
+	end
+
+	always @(*) begin
+	  case ( rd_idx )
+	    IDX_CTRL: rd_data = ctrl;
+	    IDX_SEQ: rd_data = seq;
+	    IDX_JOINT0: rd_data = joint0;
+	    IDX_JOINT1: rd_data = joint1;
+	    IDX_JOINT2: rd_data = joint2;
+	    IDX_JOINT3: rd_data = joint3;
+	    default: rd_data = 0;
+	  endcase
+	end
+
+endmodule
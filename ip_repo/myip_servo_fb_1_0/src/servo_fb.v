@@ -0,0 +1,109 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// 서보 포텐셔미터 위치 측정 (XADC 보조 채널 4개)
+// 굴삭기 보드의 JXADC 핀 (VAUX6/14/7/15)은 조이스틱이 없어서 비어 있음
+// XADC 시퀀서가 4채널을 계속 돌고, 변환이 끝날 때마다 DRP로 결과를 읽어 채널별로 저장
+//////////////////////////////////////////////////////////////////////////////////
+
+module servo_fb_xadc(
+    input clk,                   // 100MHz (DRP 클럭)
+    input reset_p,
+    input vauxp6, vauxn6,        // 관절 0 (X1)
+    input vauxp14, vauxn14,      // 관절 1 (Y1)
+    input vauxp7, vauxn7,        // 관절 2 (X2)
+    input vauxp15, vauxn15,      // 관절 3 (Y2)
+    output reg [11:0] joint0,
+    output reg [11:0] joint1,
+    output reg [11:0] joint2,
+    output reg [11:0] joint3,
+    output reg [3:0] valid,      // 채널별로 한 번이라도 변환됐는지
+    output reg [31:0] seq_cnt    // 끝난 시퀀스 수
+);
+
+    wire [15:0] aux_p, aux_n;
+    assign aux_p = {vauxp15, vauxp14, 6'd0, vauxp7, vauxp6, 6'd0};
+    assign aux_n = {vauxn15, vauxn14, 6'd0, vauxn7, vauxn6, 6'd0};
+
+    wire [4:0] channel;
+    wire [15:0] do_out;
+    wire eoc, eos, drdy;
+
+    // 변환이 끝난 채널을 DRP로 읽음 (결과는 drdy에 맞춰 나옴)
+    reg den;
+    reg [6:0] daddr;
+    reg [4:0] rd_ch;
+
+    XADC #(
+        .INIT_40(16'h1000),     // 16회 평균
+        .INIT_41(16'h2FAF),     // 연속 시퀀스 모드, 알람 끔, 보정 사용
+        .INIT_42(16'h0400),     // DCLK / 4 = ADCCLK 25MHz
+        .INIT_48(16'h0000),     // 내부 센서 채널 안 씀
+        .INIT_49(16'hC0C0),     // VAUX 6, 7, 14, 15
+        .INIT_4A(16'h0000),
+        .INIT_4B(16'hC0C0),     // 보조 채널 평균 사용
+        .INIT_4C(16'h0000),
+        .INIT_4D(16'h0000),     // 단극성
+        .INIT_4E(16'h0000),
+        .INIT_4F(16'hC0C0),     // 포텐셔미터 출력 임피던스가 커서 획득 시간 늘림
+        .SIM_DEVICE("7SERIES")
+    ) xadc (
+        .CONVST(1'b0),
+        .CONVSTCLK(1'b0),
+        .DADDR(daddr),
+        .DCLK(clk),
+        .DEN(den),
+        .DI(16'd0),
+        .DWE(1'b0),
+        .RESET(reset_p),
+        .VAUXN(aux_n),
+        .VAUXP(aux_p),
+        .ALM(),
+        .BUSY(),
+        .CHANNEL(channel),
+        .DO(do_out),
+        .DRDY(drdy),
+        .EOC(eoc),
+        .EOS(eos),
+        .JTAGBUSY(),
+        .JTAGLOCKED(),
+        .JTAGMODIFIED(),
+        .OT(),
+        .MUXADDR(),
+        .VP(1'b0),
+        .VN(1'b0)
+    );
+
+    always @(posedge clk or posedge reset_p) begin
+        if (reset_p) begin
+            den <= 0;
+            daddr <= 0;
+            rd_ch <= 0;
+            joint0 <= 0;
+            joint1 <= 0;
+            joint2 <= 0;
+            joint3 <= 0;
+            valid <= 0;
+            seq_cnt <= 0;
+        end
+        else begin
+            den <= eoc;
+            if (eoc) begin
+                daddr <= {2'b00, channel};   // 상태 레지스터 주소 = 채널 번호
+                rd_ch <= channel;
+            end
+
+            if (drdy) begin
+                case (rd_ch)
+                    5'd22: begin joint0 <= do_out[15:4]; valid[0] <= 1; end   // VAUX6
+                    5'd30: begin joint1 <= do_out[15:4]; valid[1] <= 1; end   // VAUX14
+                    5'd23: begin joint2 <= do_out[15:4]; valid[2] <= 1; end   // VAUX7
+                    5'd31: begin joint3 <= do_out[15:4]; valid[3] <= 1; end   // VAUX15
+                    default: ;
+                endcase
+            end
+
+            if (eos) seq_cnt <= seq_cnt + 1;
+        end
+    end
+
+endmodule
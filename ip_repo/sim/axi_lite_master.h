@@ -0,0 +1,179 @@
+// Verilator용 AXI4-Lite 마스터 모델 (myip_* 공통)
+// Vivado가 만든 top의 s00_axi_* 포트 이름을 그대로 쓰므로 어떤 myip_* top에도 붙일 수 있음
+//
+//   Vmyip_pwm *top = new Vmyip_pwm;
+//   AxiLiteMaster<Vmyip_pwm> bus(top);
+//   bus.on_cycle = [&] { meter.sample(top->pwm); };   // 매 클럭 출력 관찰 (버스 전송 중에도)
+//   bus.reset();
+//   bus.write(0x0, 100);
+//   uint32_t v = bus.read(0x0);
+//   bus.stream_writes(n, addr, data);                   // 응답을 기다리지 않고 매 클럭 다음 전송 (처리량 측정)
+#ifndef AXI_LITE_MASTER_H
+#define AXI_LITE_MASTER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+template <class Top>
+class AxiLiteMaster {
+public:
+    std::function<void()> on_cycle;     // 상승 엣지마다 호출
+    uint64_t cycles = 0;                // 지금까지 진행한 클럭 수
+    unsigned timeout = 1000;            // 응답을 기다릴 최대 클럭 수
+
+    explicit AxiLiteMaster(Top *top) : top_(top) {
+        top_->s00_axi_aclk = 0;
+        top_->s00_axi_aresetn = 0;
+        top_->s00_axi_awaddr = 0;
+        top_->s00_axi_awprot = 0;
+        top_->s00_axi_awvalid = 0;
+        top_->s00_axi_wdata = 0;
+        top_->s00_axi_wstrb = 0;
+        top_->s00_axi_wvalid = 0;
+        top_->s00_axi_bready = 0;
+        top_->s00_axi_araddr = 0;
+        top_->s00_axi_arprot = 0;
+        top_->s00_axi_arvalid = 0;
+        top_->s00_axi_rready = 0;
+        top_->eval();
+    }
+
+    // 한 클럭: 입력은 low 구간에서 바꾸고 상승 엣지에서 샘플됨
+    void tick() {
+        top_->s00_axi_aclk = 1;
+        top_->eval();
+        cycles++;
+        if (on_cycle) on_cycle();
+        top_->s00_axi_aclk = 0;
+        top_->eval();
+    }
+
+    void run(uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) tick();
+    }
+
+    void reset(unsigned n = 16) {
+        top_->s00_axi_aresetn = 0;
+        run(n);
+        top_->s00_axi_aresetn = 1;
+        run(4);     // 스톡 슬레이브는 리셋 후 Idle -> ready 까지 한 클럭 걸림
+    }
+
+    void write(uint32_t addr, uint32_t data, uint8_t strb = 0xF) {
+        top_->s00_axi_awaddr = addr;
+        top_->s00_axi_awvalid = 1;
+        top_->s00_axi_wdata = data;
+        top_->s00_axi_wstrb = strb;
+        top_->s00_axi_wvalid = 1;
+        top_->s00_axi_bready = 1;
+        top_->eval();
+
+        bool aw_done = false, w_done = false, b_done = false;
+        for (unsigned n = 0; !b_done; n++) {
+            if (n > timeout) fail("write", addr);
+            // 엣지 직전 값으로 핸드셰이크 판정
+            bool aw_hs = top_->s00_axi_awvalid && top_->s00_axi_awready;
+            bool w_hs = top_->s00_axi_wvalid && top_->s00_axi_wready;
+            bool b_hs = aw_done && w_done && top_->s00_axi_bvalid;
+            tick();
+            if (aw_hs) { aw_done = true; top_->s00_axi_awvalid = 0; }
+            if (w_hs) { w_done = true; top_->s00_axi_wvalid = 0; }
+            if (b_hs) b_done = true;
+            top_->eval();
+        }
+        top_->s00_axi_bready = 0;
+        top_->eval();
+    }
+
+    uint32_t read(uint32_t addr) {
+        top_->s00_axi_araddr = addr;
+        top_->s00_axi_arvalid = 1;
+        top_->s00_axi_rready = 1;
+        top_->eval();
+
+        bool ar_done = false;
+        for (unsigned n = 0;; n++) {
+            if (n > timeout) fail("read", addr);
+            bool ar_hs = top_->s00_axi_arvalid && top_->s00_axi_arready;
+            bool r_hs = ar_done && top_->s00_axi_rvalid;
+            uint32_t data = top_->s00_axi_rdata;
+            tick();
+            if (ar_hs) { ar_done = true; top_->s00_axi_arvalid = 0; }
+            top_->eval();
+            if (r_hs) {
+                top_->s00_axi_rready = 0;
+                top_->eval();
+                return data;
+            }
+        }
+    }
+
+    // n개 쓰기를 연속으로 발행: AW/W는 수락되는 대로 다음 것, B는 항상 ready
+    // 걸린 클럭 수 반환
+    uint64_t stream_writes(unsigned n, const uint32_t *addr, const uint32_t *data) {
+        unsigned aw = 0, w = 0, b = 0;
+        uint64_t start = cycles;
+
+        top_->s00_axi_bready = 1;
+        top_->s00_axi_wstrb = 0xF;
+        for (unsigned idle = 0; b < n; idle++) {
+            if (idle > timeout) fail("stream write", aw < n ? addr[aw] : 0);
+            top_->s00_axi_awvalid = aw < n;
+            top_->s00_axi_awaddr = aw < n ? addr[aw] : 0;
+            top_->s00_axi_wvalid = w < n;
+            top_->s00_axi_wdata = w < n ? data[w] : 0;
+            top_->eval();
+            bool aw_hs = top_->s00_axi_awvalid && top_->s00_axi_awready;
+            bool w_hs = top_->s00_axi_wvalid && top_->s00_axi_wready;
+            bool b_hs = top_->s00_axi_bvalid;
+            tick();
+            if (aw_hs) aw++;
+            if (w_hs) w++;
+            if (b_hs) b++;
+            if (aw_hs || w_hs || b_hs) idle = 0;
+        }
+        top_->s00_axi_awvalid = 0;
+        top_->s00_axi_wvalid = 0;
+        top_->s00_axi_bready = 0;
+        top_->eval();
+        return cycles - start;
+    }
+
+    // n개 읽기를 연속으로 발행, 읽은 값은 data[] 에 (R은 항상 ready)
+    uint64_t stream_reads(unsigned n, const uint32_t *addr, uint32_t *data) {
+        unsigned ar = 0, r = 0;
+        uint64_t start = cycles;
+
+        top_->s00_axi_rready = 1;
+        for (unsigned idle = 0; r < n; idle++) {
+            if (idle > timeout) fail("stream read", ar < n ? addr[ar] : 0);
+            top_->s00_axi_arvalid = ar < n;
+            top_->s00_axi_araddr = ar < n ? addr[ar] : 0;
+            top_->eval();
+            bool ar_hs = top_->s00_axi_arvalid && top_->s00_axi_arready;
+            bool r_hs = top_->s00_axi_rvalid;
+            uint32_t rdata = top_->s00_axi_rdata;
+            tick();
+            if (ar_hs) ar++;
+            if (r_hs) data[r++] = rdata;
+            if (ar_hs || r_hs) idle = 0;
+        }
+        top_->s00_axi_arvalid = 0;
+        top_->s00_axi_rready = 0;
+        top_->eval();
+        return cycles - start;
+    }
+
+private:
+    Top *top_;
+
+    [[noreturn]] void fail(const char *what, uint32_t addr) {
+        std::printf("FAIL: AXI %s timeout at 0x%02x (cycle %llu)\n", what, addr,
+                    (unsigned long long)cycles);
+        std::exit(1);
+    }
+};
+
+#endif
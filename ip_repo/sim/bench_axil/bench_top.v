@@ -0,0 +1,86 @@
+`timescale 1 ns / 1 ps
+// AXI4-Lite 슬레이브 벤치마크용 top: 레지스터 8개, 포트 이름은 myip_* top 과 같은 s00_axi_*
+// BENCH_STOCK 정의 시 스톡 상태 머신, 아니면 axil_slave_pipe
+
+	module bench_top
+	(
+		input wire  s00_axi_aclk,
+		input wire  s00_axi_aresetn,
+		input wire [4 : 0] s00_axi_awaddr,
+		input wire [2 : 0] s00_axi_awprot,
+		input wire  s00_axi_awvalid,
+		output wire  s00_axi_awready,
+		input wire [31 : 0] s00_axi_wdata,
+		input wire [3 : 0] s00_axi_wstrb,
+		input wire  s00_axi_wvalid,
+		output wire  s00_axi_wready,
+		output wire [1 : 0] s00_axi_bresp,
+		output wire  s00_axi_bvalid,
+		input wire  s00_axi_bready,
+		input wire [4 : 0] s00_axi_araddr,
+		input wire [2 : 0] s00_axi_arprot,
+		input wire  s00_axi_arvalid,
+		output wire  s00_axi_arready,
+		output wire [31 : 0] s00_axi_rdata,
+		output wire [1 : 0] s00_axi_rresp,
+		output wire  s00_axi_rvalid,
+		input wire  s00_axi_rready
+	);
+
+`ifdef BENCH_STOCK
+	axil_stock_slave # (
+		.C_S_AXI_DATA_WIDTH(32),
+		.C_S_AXI_ADDR_WIDTH(5)
+	) dut (
+`else
+	wire  wr_en;
+	wire [2:0] wr_idx;
+	wire [31:0] wr_data;
+	wire [3:0] wr_strb;
+	wire  rd_en;
+	wire [2:0] rd_idx;
+	reg [31:0] regs [0:7];
+	integer byte_index;
+
+	always @( posedge s00_axi_aclk )
+	  if ( wr_en )
+	    for ( byte_index = 0; byte_index < 4; byte_index = byte_index+1 )
+	      if ( wr_strb[byte_index] )
+	        regs[wr_idx][(byte_index*8) +: 8] <= wr_data[(byte_index*8) +: 8];
+
+	axil_slave_pipe # (
+		.C_S_AXI_DATA_WIDTH(32),
+		.C_S_AXI_ADDR_WIDTH(5)
+	) dut (
+		.wr_en(wr_en),
+		.wr_idx(wr_idx),
+		.wr_data(wr_data),
+		.wr_strb(wr_strb),
+		.rd_en(rd_en),
+		.rd_idx(rd_idx),
+		.rd_data(regs[rd_idx]),
+`endif
+		.S_AXI_ACLK(s00_axi_aclk),
+		.S_AXI_ARESETN(s00_axi_aresetn),
+		.S_AXI_AWADDR(s00_axi_awaddr),
+		.S_AXI_AWPROT(s00_axi_awprot),
+		.S_AXI_AWVALID(s00_axi_awvalid),
+		.S_AXI_AWREADY(s00_axi_awready),
+		.S_AXI_WDATA(s00_axi_wdata),
+		.S_AXI_WSTRB(s00_axi_wstrb),
+		.S_AXI_WVALID(s00_axi_wvalid),
+		.S_AXI_WREADY(s00_axi_wready),
+		.S_AXI_BRESP(s00_axi_bresp),
+		.S_AXI_BVALID(s00_axi_bvalid),
+		.S_AXI_BREADY(s00_axi_bready),
+		.S_AXI_ARADDR(s00_axi_araddr),
+		.S_AXI_ARPROT(s00_axi_arprot),
+		.S_AXI_ARVALID(s00_axi_arvalid),
+		.S_AXI_ARREADY(s00_axi_arready),
+		.S_AXI_RDATA(s00_axi_rdata),
+		.S_AXI_RRESP(s00_axi_rresp),
+		.S_AXI_RVALID(s00_axi_rvalid),
+		.S_AXI_RREADY(s00_axi_rready)
+	);
+
+	endmodule
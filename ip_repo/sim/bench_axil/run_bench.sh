@@ -0,0 +1,20 @@
+#!/bin/sh
+# 스톡 AXI4-Lite 슬레이브 vs axil_slave_pipe 처리량 비교 (verilator 필요)
+#   ./run_bench.sh
+set -e
+cd "$(dirname "$0")"
+
+build() {
+    name=$1; shift
+    verilator --cc --exe --build -j 0 -O3 -Wno-fatal -Wno-lint -Wno-style \
+        --top-module bench_top --prefix Vbench --Mdir "obj_$name" \
+        -CFLAGS "-O2 -I$(pwd)/.. -DBENCH_NAME=\\\"$name\\\"" "$@" \
+        bench_top.v tb_axil_bench.cpp -o tb_axil_bench
+}
+
+build stock -DBENCH_STOCK stock_slave.v
+build pipe ../../common/hdl/axil_slave_pipe.v
+
+./obj_stock/tb_axil_bench | tee bench.log
+./obj_pipe/tb_axil_bench | tee -a bench.log
+[ "$(grep -c '^PASS' bench.log)" = 2 ]
@@ -0,0 +1,60 @@
+// PWM 출력 측정기: 매 클럭 sample() 하면 상승 엣지 사이 주기와 high 길이를 클럭 단위로 모음
+#ifndef PWM_METER_H
+#define PWM_METER_H
+
+#include <cstdint>
+
+class PwmMeter {
+public:
+    uint64_t periods = 0;               // 측정한 완전한 주기 수
+    uint64_t period_min = 0, period_max = 0, period_sum = 0;
+    uint64_t high_min = 0, high_max = 0, high_sum = 0;
+    uint64_t samples = 0, high_samples = 0;
+
+    // 측정 초기화 (설정을 바꾼 뒤 안정될 때까지 기다렸다가 호출)
+    void clear() {
+        periods = period_min = period_max = period_sum = 0;
+        high_min = high_max = high_sum = 0;
+        samples = high_samples = 0;
+        have_rise_ = false;
+        now_ = 0;
+    }
+
+    void sample(bool level) {
+        if (level && !prev_) {
+            if (have_rise_) {
+                add(now_ - rise_, high_len_);
+            }
+            rise_ = now_;
+            have_rise_ = true;
+        }
+        if (!level && prev_) high_len_ = now_ - rise_;
+
+        samples++;
+        if (level) high_samples++;
+        prev_ = level;
+        now_++;
+    }
+
+    bool always_low() const { return samples && high_samples == 0; }
+    bool always_high() const { return samples && high_samples == samples; }
+
+private:
+    bool prev_ = false;
+    bool have_rise_ = false;
+    uint64_t now_ = 0;
+    uint64_t rise_ = 0;
+    uint64_t high_len_ = 0;
+
+    void add(uint64_t period, uint64_t high) {
+        if (periods == 0 || period < period_min) period_min = period;
+        if (periods == 0 || period > period_max) period_max = period;
+        if (periods == 0 || high < high_min) high_min = high;
+        if (periods == 0 || high > high_max) high_max = high;
+        period_sum += period;
+        high_sum += high;
+        periods++;
+    }
+};
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * 작업 모드 축 예측 호스트 시뮬레이션
+ *   src/axis_pred.c (보드와 같은 코드) + 20ms 송신 프레임 + 블루투스 끊김 구간
+ *
+ *   axis_pred_sim [log.csv]
+ *       X1: 중립 밖에서 계속 움직이는 스틱, Y1: 끊긴 동안 스틱을 놓음 (중립으로 복귀)
+ *       예측 없이 마지막 값 유지한 경우와 비교해 끊김 뒤 튀는 양이 줄지 않거나
+ *       예측이 중립을 넘어 반대쪽으로 가면 FAIL
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "axis_pred.h"
+
+#define NEUTRAL_MIN     1500        // motion.h 와 같음
+#define NEUTRAL_MAX     2600
+#define FRAME_MS        20          // 송신부 task_frame 주기
+#define TICK_MS         20          // JOINT_TICK_MS
+#define TICK_PHASE_MS   7           // 프레임과 틱은 맞춰져 있지 않음
+#define SIM_END_MS      6000
+
+// 끊김 구간 [시작, 끝) ms: 이 안에 보낸 프레임은 사라짐
+static const int gaps[][2] = {
+    { 500, 540 }, { 1100, 1160 }, { 1700, 1780 }, { 2300, 2400 }, { 2900, 3040 },
+    { 4480, 4580 },     // Y1 놓는 중
+};
+#define GAP_COUNT   (int)(sizeof(gaps) / sizeof(gaps[0]))
+
+static int dropped(int t)
+{
+    for (int i = 0; i < GAP_COUNT; i++)
+        if (t >= gaps[i][0] && t < gaps[i][1]) return 1;
+    return 0;
+}
+
+// 실제 스틱 위치
+static int32_t stick(int axis, int t)
+{
+    double s = t / 1000.0;
+    switch (axis) {
+        case 0: return (int32_t)(3350 + 700 * sin(2 * M_PI * s / 1.5));    // X1: 2650~4050
+        case 1:                                                             // Y1: 4.4s부터 200ms 동안 놓음
+            if (t < 4400) return 3900;
+            if (t < 4600) return 3900 - (3900 - 2048) * (t - 4400) / 200;
+            return 2048;
+        default: return 2048;
+    }
+}
+
+typedef struct {
+    int32_t prev;       // 마지막으로 적용한 값
+    int32_t max_step;   // 적용 한 번에 바뀐 양 최대 (튐)
+    int32_t max_err;    // 실제 스틱과 차이 최대
+    int32_t min_val;
+} track_t;
+
+static void track(track_t *k, int32_t v, int32_t real)
+{
+    int32_t step = abs(v - k->prev);
+    if (step > k->max_step) k->max_step = step;
+    if (abs(v - real) > k->max_err) k->max_err = abs(v - real);
+    if (v < k->min_val) k->min_val = v;
+    k->prev = v;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *log = fopen(argc > 1 ? argv[1] : "axis_gap.csv", "w");
+    if (!log) { perror("log"); return 1; }
+    fprintf(log, "t_ms,real_x1,pred_x1,hold_x1,real_y1,pred_y1,hold_y1\n");
+
+    axis_pred_t p;
+    axis_pred_init(&p, NEUTRAL_MIN, NEUTRAL_MAX);
+
+    int32_t hold[AXIS_PRED_AXES] = { 0 }, out[AXIS_PRED_AXES] = { 0 };
+    track_t kp[2], kh[2];
+    for (int a = 0; a < 2; a++) {
+        kp[a] = (track_t){ stick(a, 0), 0, 0, 4095 };
+        kh[a] = kp[a];
+    }
+
+    for (int t = 0; t < SIM_END_MS; t++) {
+        int applied = 0;
+
+        if (t % FRAME_MS == 0 && !dropped(t)) {
+            int32_t in[AXIS_PRED_AXES];
+            for (int a = 0; a < AXIS_PRED_AXES; a++) in[a] = stick(a, t);
+            axis_pred_frame(&p, in, t, out);
+            for (int a = 0; a < AXIS_PRED_AXES; a++) hold[a] = in[a];
+            applied = 1;
+        }
+        if (t % TICK_MS == TICK_PHASE_MS && axis_pred_tick(&p, t, out)) applied = 1;
+
+        if (applied || t % TICK_MS == TICK_PHASE_MS) {
+            for (int a = 0; a < 2; a++) {
+                if (t < 100) { kp[a].prev = out[a]; kh[a].prev = hold[a]; continue; }
+                track(&kp[a], out[a], stick(a, t));
+                track(&kh[a], hold[a], stick(a, t));
+            }
+            fprintf(log, "%d,%d,%d,%d,%d,%d,%d\n", t, stick(0, t), out[0], hold[0],
+                stick(1, t), out[1], hold[1]);
+        }
+    }
+    fclose(log);
+
+    int fail = 0;
+    const char *name[2] = { "X1", "Y1" };
+    for (int a = 0; a < 2; a++) {
+        printf("%s: step pred %d / hold %d, err pred %d / hold %d, gaps %u, pred ticks %u, resync err max %u\n",
+            name[a], kp[a].max_step, kh[a].max_step, kp[a].max_err, kh[a].max_err,
+            p.st[a].gaps, p.st[a].pred_ticks, p.st[a].max_err);
+    }
+    printf("max gap %ums\n", p.max_gap_ms);
+
+    // 움직이는 축: 끊김 뒤 튀는 양과 추종 오차가 둘 다 줄어야 함
+    if (kp[0].max_step * 2 > kh[0].max_step) fail = 1;
+    if (kp[0].max_err >= kh[0].max_err) fail = 1;
+    if (p.st[0].gaps != GAP_COUNT) fail = 1;
+    // 놓는 중 끊김: 예측이 중립을 지나 반대쪽(후진)으로 가면 안 됨
+    printf("Y1 min during release: %d (neutral %d..%d)\n", kp[1].min_val, NEUTRAL_MIN, NEUTRAL_MAX);
+    if (kp[1].min_val < NEUTRAL_MIN) fail = 1;
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -0,0 +1,126 @@
+/*
+ * 조종기 명령 재생 버퍼 호스트 시뮬레이션
+ *   src/playout.c (보드와 같은 코드) + 20ms 송신 + 블루투스 지연 모델 (뭉쳐 오기, 가끔 긴 지연)
+ *
+ *   playout_sim [log.csv]
+ *       받는 즉시 적용한 경우와 재생 버퍼를 거친 경우의 적용 간격/지연을 비교
+ *       간격 흔들림이 줄지 않거나, 버퍼에 머문 시간이 PLAYOUT_TARGET_MS 를 넘거나, 늦은 프레임이 많으면 FAIL
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "playout.h"
+
+#define FRAME_MS        20          // 송신부 task_frame 주기
+#define SIM_FRAMES      3000        // 60초
+#define BASE_DELAY_US   9000        // 링크 지연 바닥 (38400bps 20바이트 + HC-05)
+#define CLOCK_OFFS_MS   123456      // 수신부 시계 - 송신부 시계
+#define CLOCK_PPM       80          // 수신부 시계가 이만큼 빠름
+#define POLL_US         200         // 수신부 루프 한 바퀴
+
+static uint32_t rnd(void)
+{
+    static uint32_t s = 12345;
+    s = s * 1103515245 + 12345;
+    return s >> 8;
+}
+
+// 프레임 n 의 추가 지연: HC-05가 두 프레임씩 모아 보내고, 가끔 블루투스 재전송
+static uint32_t extra_delay_us(int n)
+{
+    uint32_t d = rnd() % 4000;
+    if (n % 2 == 0) d += 10000;                 // 다음 프레임과 같이 나감
+    if (rnd() % 60 == 0) d += 20000 + rnd() % 20000;
+    return d;
+}
+
+typedef struct {
+    double sum, sum2;
+    int n;
+    uint32_t max_dev;
+    uint32_t last;
+    int have;
+} gap_stat_t;
+
+static void gap_update(gap_stat_t *g, uint32_t t)
+{
+    if (g->have) {
+        int32_t d = (int32_t)(t - g->last) - FRAME_MS * 1000;
+        uint32_t dev = d < 0 ? -d : d;
+        if (dev > g->max_dev) g->max_dev = dev;
+        g->sum += d;
+        g->sum2 += (double)d * d;
+        g->n++;
+    }
+    g->last = t;
+    g->have = 1;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *log = fopen(argc > 1 ? argv[1] : "playout.csv", "w");
+    if (!log) { perror("log"); return 1; }
+    fprintf(log, "n,tx_ms,arrive_us,apply_us,delay_us\n");
+
+    static uint32_t arrive[SIM_FRAMES];
+    uint32_t last_arrive = 0;
+    for (int n = 0; n < SIM_FRAMES; n++) {
+        uint64_t tx_us = (uint64_t)n * FRAME_MS * 1000;
+        uint64_t rx_clock = tx_us + tx_us * CLOCK_PPM / 1000000 + (uint64_t)CLOCK_OFFS_MS * 1000;
+        uint32_t a = (uint32_t)(rx_clock + BASE_DELAY_US + extra_delay_us(n));
+        if ((int32_t)(a - last_arrive) < 0 && n) a = last_arrive;  // UART는 순서를 안 바꿈
+        arrive[n] = last_arrive = a;
+    }
+
+    playout_t p;
+    playout_init(&p, PLAYOUT_TARGET_MS);
+    gap_stat_t raw = { 0 }, play = { 0 };
+    uint32_t max_lat = 0, max_hold = 0;
+    int next = 0, applied = 0;
+    uint32_t now = arrive[0] - POLL_US;
+
+    while (applied < SIM_FRAMES) {
+        now += POLL_US;
+        // 같은 바퀴에 도착한 프레임 전부 넣고 나서 재생 (보드 루프와 같은 순서)
+        while (next < SIM_FRAMES && (int32_t)(now - arrive[next]) >= 0) {
+            uint32_t msg[2] = { (uint32_t)next, 0 };
+            gap_update(&raw, now);
+            playout_put(&p, next * FRAME_MS, now, msg, 2);
+            next++;
+        }
+        uint32_t msg[2];
+        while (playout_take(&p, now, msg, 2)) {
+            int n = msg[0];
+            gap_update(&play, now);
+            // 지연: 같은 프레임이 아무 흔들림 없이 왔을 때 시각 기준
+            uint64_t tx_us = (uint64_t)n * FRAME_MS * 1000;
+            uint32_t ideal = (uint32_t)(tx_us + tx_us * CLOCK_PPM / 1000000 + (uint64_t)CLOCK_OFFS_MS * 1000 + BASE_DELAY_US);
+            uint32_t lat = now - ideal;
+            uint32_t hold = now - arrive[n];    // 버퍼에 머문 시간 (재생 버퍼가 더한 지연)
+            if (n > 100 && lat > max_lat) max_lat = lat;
+            if (n > 100 && hold > max_hold) max_hold = hold;
+            fprintf(log, "%d,%d,%u,%u,%u\n", n, n * FRAME_MS, arrive[n], now, p.delay_us);
+            applied++;
+        }
+    }
+    fclose(log);
+
+    double raw_sd = raw.n ? sqrt(raw.sum2 / raw.n) : 0;
+    double play_sd = play.n ? sqrt(play.sum2 / play.n) : 0;
+    printf("interval dev raw: rms %.0fus max %uus\n", raw_sd, raw.max_dev);
+    printf("interval dev play: rms %.0fus max %uus\n", play_sd, play.max_dev);
+    printf("latency over floor: max %uus, held in buffer: max %uus (target %dms), delay now %uus, jitter %uus\n",
+        max_lat, max_hold, PLAYOUT_TARGET_MS, p.delay_us, p.jitter_us);
+    printf("frames %u late %u dropped %u\n", p.frames, p.late, p.dropped);
+
+    int fail = 0;
+    if (play_sd * 3 > raw_sd) fail = 1;
+    // 늦게 온 프레임은 도착 즉시라 바닥 위 지연은 그만큼 길 수 있음, 버퍼가 더하는 지연은 상한 이내
+    if (max_hold > PLAYOUT_TARGET_MS * 1000 + POLL_US) fail = 1;
+    if (p.late * 20 > p.frames) fail = 1;
+    if (p.dropped) fail = 1;
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
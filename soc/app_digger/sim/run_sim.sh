@@ -0,0 +1,17 @@
+#!/bin/sh
+# 호스트 시뮬레이션 (보드 코드를 그대로 링크)
+#   ./run_sim.sh [wheel.csv] [axis.csv] [playout.csv]
+# 바퀴 속도 제어 스텝 응답: src/wheel_ctl.c, 이득(wheel_gains)을 바꾸면 여기서 먼저 확인
+# 작업 모드 끊김 예측: src/axis_pred.c, 예측 시간/재동기 속도를 바꾸면 여기서 먼저 확인
+# 명령 재생 버퍼: src/playout.c, PLAYOUT_TARGET_MS 를 바꾸면 여기서 먼저 확인
+set -e
+cd "$(dirname "$0")"
+
+cc -O2 -Wall -Wextra -I../src -o wheel_ctl_sim wheel_ctl_sim.c ../src/wheel_ctl.c -lm
+cc -O2 -Wall -Wextra -I../src -o axis_pred_sim axis_pred_sim.c ../src/axis_pred.c -lm
+cc -O2 -Wall -Wextra -I../src -o playout_sim playout_sim.c ../src/playout.c -lm
+./wheel_ctl_sim "${1:-wheel_step.csv}" | tee sim.log
+./axis_pred_sim "${2:-axis_gap.csv}" | tee -a sim.log
+./playout_sim "${3:-playout.csv}" | tee -a sim.log
+
+! grep -q '^FAIL' sim.log
@@ -0,0 +1,201 @@
+/*
+ * 바퀴 속도 제어 호스트 시뮬레이션
+ *   src/wheel_ctl.c (보드와 같은 코드) + DC 모터 1차 모델 + myip_encoder 주기 측정 모델
+ *
+ *   wheel_ctl_sim [log.csv]
+ *       스텝 / 부하 / 역전 / 포화 구간을 돌리고 응답을 CSV로 남긴다. 기준을 넘으면 FAIL
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "wheel_ctl.h"
+
+#define SYS_CLK_FREQ    100000000
+#define SIM_DT          10e-6           // 모델 적분 간격 (10us = 1000클럭)
+#define SIM_CLK_PER_DT  1000
+#define SIM_END         2.5
+#define ENC_TIMEOUT     (SYS_CLK_FREQ / 10)
+#define HB_RAMP_PERMIL  0               // 폐루프에서는 myip_hbridge ACCEL = 0 (0이면 제한 없음)
+
+// 모터 + 기어 + 엔코더 (보드 측정값 근처로 잡은 모델)
+typedef struct {
+    double kv;          // 정상상태 카운트/초 per duty‰ (정지마찰 넘는 부분)
+    double d0;          // 정지마찰 duty‰
+    double tau;         // 기계 시정수 (s)
+    double load;        // 외란 (duty‰ 환산)
+    double w;           // 현재 속도 (카운트/초)
+    double pos;         // 위치 (카운트, 실수)
+    double applied;     // H-bridge가 실제로 내보내는 duty (램프 적용)
+    // myip_encoder 주기 측정
+    long cnt;
+    int64_t last_edge;
+    int64_t period;     // 부호 있음, 0 = 정지
+} motor_t;
+
+static void motor_step(motor_t *m, double duty, int64_t clk)
+{
+    // H-bridge 가속 제한 (PWM 주기마다 조금씩)
+    double ramp = HB_RAMP_PERMIL * SIM_DT * 1000.0;
+    if (ramp == 0) m->applied = duty;
+    else if (duty > m->applied + ramp) m->applied += ramp;
+    else if (duty < m->applied - ramp) m->applied -= ramp;
+    else m->applied = duty;
+
+    double u = m->applied - m->load;
+    double drive = 0;
+    if (u > m->d0) drive = u - m->d0;
+    else if (u < -m->d0) drive = u + m->d0;
+
+    double prev = m->pos;
+    m->w += (m->kv * drive - m->w) * SIM_DT / m->tau;
+    m->pos += m->w * SIM_DT;
+
+    // 카운트 경계를 지난 시각을 적분 간격 안에서 보간 (엔코더 IP는 10ns 분해능)
+    long c = (long)floor(m->pos);
+    while (c != m->cnt) {
+        int dir = c > m->cnt ? 1 : -1;
+        double edge = dir > 0 ? m->cnt + 1 : m->cnt;
+        m->cnt += dir;
+        int64_t at = clk + (int64_t)((edge - prev) / (m->pos - prev) * SIM_CLK_PER_DT);
+        int64_t age = at - m->last_edge;
+        m->period = (age >= ENC_TIMEOUT) ? 0 : dir * age;
+        m->last_edge = at;
+    }
+    if (clk - m->last_edge >= ENC_TIMEOUT) m->period = 0;
+}
+
+// wheel_enc_sample() 와 같은 계산 (경과 시간이 더 길면 그 값을 씀)
+static int32_t motor_meas_cps(const motor_t *m, int64_t clk)
+{
+    if (m->period == 0) return 0;
+    int64_t mag = m->period < 0 ? -m->period : m->period;
+    int64_t age = clk - m->last_edge;
+    if (age > mag) mag = age;
+    int64_t p = m->period < 0 ? -mag : mag;
+    return (int32_t)(SYS_CLK_FREQ / p);
+}
+
+// 구간별 목표 (두 바퀴 같음)
+//   0.05s 스텝, 0.60s 왼쪽 부하, 1.00s 역전, 1.50s 왼쪽이 걸려 멈춤 (출력 포화), 2.00s 풀림
+static int32_t target_at(double t)
+{
+    if (t < 0.05) return 0;
+    if (t < 1.00) return 3000;
+    if (t < 1.50) return -3000;
+    return 3000;
+}
+
+static double load_at(int wheel, double t)
+{
+    if (wheel != 0) return 0;
+    if (t >= 0.60 && t < 1.00) return 120;     // 흙을 밀기 시작
+    if (t >= 1.50 && t < 2.00) return 2000;    // 돌에 걸림: 최대 duty로도 못 움직임
+    return 0;
+}
+
+typedef struct {
+    double t0, t1;      // 구간
+    int32_t target;
+    double rise_s;      // 10->90% 시간
+    double settle_s;    // 마지막으로 ±2% 밖이었던 시각 - t0
+    double peak;
+} seg_stat_t;
+
+static void seg_update(seg_stat_t *s, double t, int32_t from, int32_t meas)
+{
+    if (t < s->t0 || t >= s->t1) return;
+    double span = s->target - from;
+    double frac = (meas - from) / span;
+    if (s->rise_s < 0 && frac >= 0.9) s->rise_s = t - s->t0;
+    if (frac > s->peak) s->peak = frac;
+    if (abs(meas - s->target) > abs(s->target) / 50) s->settle_s = t - s->t0;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *log = fopen(argc > 1 ? argv[1] : "wheel_step.csv", "w");
+    if (!log) { perror("log"); return 1; }
+    fprintf(log, "t_ms,target,meas_l,meas_r,duty_l,duty_r,pos_l,pos_r\n");
+
+    motor_t m[2] = {
+        { .kv = 7.2, .d0 = 55, .tau = 0.060 },     // 왼쪽
+        { .kv = 6.6, .d0 = 70, .tau = 0.075 },     // 오른쪽: 마찰 크고 느림
+    };
+    wheel_pi_t pi[2];
+    wheel_pi_init(&pi[0], &wheel_gains[0]);
+    wheel_pi_init(&pi[1], &wheel_gains[1]);
+
+    seg_stat_t step[2], rev[2];
+    seg_stat_t load = { 0.60, 1.00, 3000, -1, 0, 0 }, stall = { 2.00, SIM_END, 3000, -1, 0, 0 };
+    for (int i = 0; i < 2; i++) {
+        step[i] = (seg_stat_t){ 0.05, 0.60, 3000, -1, 0, 0 };
+        rev[i] = (seg_stat_t){ 1.00, 1.50, -3000, -1, 0, 0 };
+    }
+    double load_min = 1e9;
+    long straight_err = 0;
+
+    int32_t duty[2] = { 0, 0 };
+    long steps_per_tick = (long)(1.0 / WHEEL_CTL_RATE_HZ / SIM_DT + 0.5);
+    long n_end = (long)(SIM_END / SIM_DT);
+
+    for (long n = 0; n < n_end; n++) {
+        double t = n * SIM_DT;
+        int64_t clk = (int64_t)n * SIM_CLK_PER_DT;
+
+        m[0].load = load_at(0, t);
+        m[1].load = load_at(1, t);
+
+        if (n % steps_per_tick == 0) {
+            int32_t target = target_at(t);
+            int32_t meas[2];
+            for (int i = 0; i < 2; i++) {
+                meas[i] = motor_meas_cps(&m[i], clk);
+                duty[i] = wheel_pi_step(&pi[i], target, meas[i]);
+            }
+            fprintf(log, "%.0f,%d,%d,%d,%d,%d,%ld,%ld\n", t * 1000, target,
+                meas[0], meas[1], duty[0], duty[1], m[0].cnt, m[1].cnt);
+
+            for (int i = 0; i < 2; i++) {
+                seg_update(&step[i], t, 0, meas[i]);
+                seg_update(&rev[i], t, 3000, meas[i]);
+            }
+            if (t >= 0.60 && t < 1.00) {
+                seg_update(&load, t, 0, meas[0]);
+                if (meas[0] < load_min) load_min = meas[0];
+            }
+            if (t >= 2.00) seg_update(&stall, t, 0, meas[0]);
+            if (t < 1.00) {
+                long d = labs(m[0].cnt - m[1].cnt);
+                if (d > straight_err) straight_err = d;
+            }
+        }
+
+        // duty는 다음 제어 주기까지 유지
+        motor_step(&m[0], duty[0], clk);
+        motor_step(&m[1], duty[1], clk);
+    }
+    fclose(log);
+
+    int fail = 0;
+    const char *side[2] = { "L", "R" };
+    for (int i = 0; i < 2; i++) {
+        printf("step %s: rise %.0fms overshoot %.1f%% settle %.0fms\n", side[i],
+            step[i].rise_s * 1000, (step[i].peak - 1) * 100, step[i].settle_s * 1000);
+        printf("rev  %s: rise %.0fms overshoot %.1f%% settle %.0fms\n", side[i],
+            rev[i].rise_s * 1000, (rev[i].peak - 1) * 100, rev[i].settle_s * 1000);
+        if (step[i].rise_s < 0 || step[i].rise_s > 0.15) fail = 1;
+        if (step[i].peak > 1.10 || step[i].settle_s > 0.30) fail = 1;
+        if (rev[i].peak > 1.10 || rev[i].settle_s > 0.35) fail = 1;
+    }
+    printf("load L: dip to %.0f cps, settle %.0fms\n", load_min, load.settle_s * 1000);
+    // 적분이 포화 동안 쌓였다면 풀리는 순간 크게 넘침
+    printf("stall L: release overshoot %.1f%% settle %.0fms\n", (stall.peak - 1) * 100, stall.settle_s * 1000);
+    if (stall.peak > 1.15 || stall.settle_s > 0.30) fail = 1;
+    printf("straight: max |posL-posR| %ld counts before 1.0s\n", straight_err);
+    if (load_min < 3000 * 0.80 || load.settle_s > 0.20) fail = 1;
+    if (straight_err > 150) fail = 1;
+
+    printf(fail ? "FAIL\n" : "PASS\n");
+    return fail;
+}
@@ -30,6 +30,20 @@ set(USER_INCLUDE_DIRECTORIES
 set(USER_COMPILE_SOURCES
 "platform.c"
 "helloworld.c"
+"pwm_out.c"
+"wheel_enc.c"
+"wheel_ctl.c"
+"joint_fb.c"
+"motion.c"
+"mailbox.c"
+"cycles.c"
+"motion_core.c"
+"link_rx.c"
+"axis_map.c"
+"estop.c"
+"axis_pred.c"
+"playout.c"
+"rtos_main.c"
 )
 
 # -----------------------------------------
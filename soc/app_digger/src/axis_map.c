@@ -0,0 +1,123 @@
+#include "axis_map.h"
+#include "motion.h"
+#include "playout.h"
+#include "xil_io.h"
+
+#ifdef AXIS_MAP_HW
+
+#define MAP_ADDR            XPAR_MYIP_AXIS_MAP_0_BASEADDR
+
+// myip_axis_map 레지스터 (ip_repo/myip_axis_map_1_0/regmap.json)
+#define MAP_CTRL            0x00
+#define MAP_IN01            0x04
+#define MAP_IN23            0x08
+#define MAP_PROBE           0x18
+#define MAP_PROBE_OUT       0x1C
+#define MAP_OUT(j)          (0x20 + (j) * 4)
+#define MAP_LUT             0x8000      // 워드 하나에 항목 2개, 쓰기 전용
+
+#define MAP_CTRL_LINK_EN    (1u << 4)
+#define MAP_CTRL_MODE(m)    ((uint32_t)(m) << 8)
+#define MAP_PROBE_VALID     (1u << 31)
+#define MAP_JOINTS_ALL      ((1u << JOINT_COUNT) - 1)
+
+// 항목 펄스폭 단위 0.1us, IP 출력은 100MHz 클럭 수 (x10)
+#define UNITS_MIN           5000        // 0도 = 0.5ms
+#define UNITS_SPAN          20000       // 180도 = 2.5ms
+#define TICKS_PER_UNIT      10
+
+static uint32_t map_ctrl;
+static uint32_t override_mask;
+
+// move_servo()/move_y2_servo()와 같은 식: 중립 구간이면 center, 양쪽으로 0 ~ 2 x center
+static uint16_t curve_entry(int val, int center) {
+    int target = center;
+    uint16_t flag = 0;
+
+    if (val < NEUTRAL_MIN) {
+        target = center + (NEUTRAL_MIN - val) * center / NEUTRAL_MIN;
+    } else if (val > NEUTRAL_MAX) {
+        target = center - (val - NEUTRAL_MAX) * center / (4095 - NEUTRAL_MAX);
+    } else {
+        flag = AXIS_MAP_NEUTRAL;
+    }
+    if (target < 0) target = 0;
+    if (target > 2 * center) target = 2 * center;
+    return flag | (uint16_t)(UNITS_MIN + UNITS_SPAN * target / 180);
+}
+
+static void lut_write(int axis, int val, uint32_t pair) {
+    Xil_Out32(MAP_ADDR + MAP_LUT + (axis * AXIS_MAP_LEN + val) * 2, pair);
+}
+
+void axis_map_curve(int axis, const uint16_t *ent) {
+    for (int v = 0; v < AXIS_MAP_LEN; v += 2) {
+        lut_write(axis, v, ent[v] | ((uint32_t)ent[v + 1] << 16));
+    }
+}
+
+int axis_map_probe(int axis, int val) {
+    Xil_Out32(MAP_ADDR + MAP_PROBE, axis * AXIS_MAP_LEN + val);
+    for (int i = 0; i < 16; i++) {
+        uint32_t r = Xil_In32(MAP_ADDR + MAP_PROBE_OUT);
+        if (r & MAP_PROBE_VALID) return r & 0xFFFF;
+    }
+    return -1;
+}
+
+int axis_map_init(void) {
+    Xil_Out32(MAP_ADDR + MAP_CTRL, 0);
+    map_ctrl = 0;
+    override_mask = 0;
+
+    // 기본 곡선: 기존 펌웨어 매핑과 같음 (Y2만 0~90도)
+    for (int a = 0; a < JOINT_COUNT; a++) {
+        int center = (a == PWM_CH_Y2) ? 45 : 90;
+        for (int v = 0; v < AXIS_MAP_LEN; v += 2) {
+            lut_write(a, v, curve_entry(v, center) | ((uint32_t)curve_entry(v + 1, center) << 16));
+        }
+    }
+
+    // 표가 안 읽히면 IP 없이 펌웨어 매핑 그대로
+    for (int a = 0; a < JOINT_COUNT; a++) {
+        int center = (a == PWM_CH_Y2) ? 45 : 90;
+        if (axis_map_probe(a, 0) != curve_entry(0, center) ||
+            axis_map_probe(a, 4095) != curve_entry(4095, center)) return 0;
+    }
+
+    // 작업 모드 링크 프레임은 CPU를 거치지 않고 바로 변환
+    // 재생 버퍼를 쓰면 도착 즉시 변환하면 안 되므로 펌웨어 입력(IN01/IN23)만
+    map_ctrl = MAP_JOINTS_ALL | (PLAYOUT_TARGET_MS ? 0 : MAP_CTRL_LINK_EN) | MAP_CTRL_MODE(1);
+    Xil_Out32(MAP_ADDR + MAP_CTRL, map_ctrl);
+    return 1;
+}
+
+// IN23 쓰기가 네 축을 한꺼번에 변환 (중립 체크도 IP가 함)
+void axis_map_input(int x1, int y1, int x2, int y2) {
+    Xil_Out32(MAP_ADDR + MAP_IN01, (uint32_t)x1 | ((uint32_t)y1 << 16));
+    Xil_Out32(MAP_ADDR + MAP_IN23, (uint32_t)x2 | ((uint32_t)y2 << 16));
+}
+
+void axis_map_override(uint32_t mask) {
+    mask &= MAP_JOINTS_ALL;
+    if (mask == override_mask || !map_ctrl) return;
+    override_mask = mask;
+    Xil_Out32(MAP_ADDR + MAP_CTRL, map_ctrl & ~mask);
+}
+
+uint32_t axis_map_overridden(void) {
+    return map_ctrl ? override_mask : MAP_JOINTS_ALL;
+}
+
+void axis_map_sync(int *const angle[]) {
+    if (!map_ctrl) return;
+    for (int j = 0; j < JOINT_COUNT; j++) {
+        if (override_mask & (1u << j)) continue;
+        uint32_t ticks = Xil_In32(MAP_ADDR + MAP_OUT(j));
+        if (ticks == 0) continue;   // 아직 변환 결과 없음 (PWM도 DUTY 레지스터 사용 중)
+        int units = ticks / TICKS_PER_UNIT;
+        *angle[j] = ((units - UNITS_MIN) * 180 + UNITS_SPAN / 2) / UNITS_SPAN;
+    }
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef AXIS_MAP_H
+#define AXIS_MAP_H
+
+#include <stdint.h>
+#include "xparameters.h"
+#include "pwm_out.h"
+
+#if defined(XPAR_MYIP_AXIS_MAP_0_BASEADDR) && defined(PWM_OUT_HW_SLEW)
+#define AXIS_MAP_HW         // 작업 모드 조이스틱 → 관절 펄스폭 변환을 IP 표가 처리 (PWM IP에 직접 연결)
+#endif
+
+#define AXIS_MAP_LEN        4096    // 축마다 표 항목 수 (12비트 입력)
+#define AXIS_MAP_NEUTRAL    (1u << 15)  // 항목 중립 구간 비트, [14:0] 펄스폭 0.1us (0 = 관절 그대로)
+
+int axis_map_init(void);                    // 기본 곡선 적재 후 확인되면 사용 시작, 1 = 사용 중
+void axis_map_input(int x1, int y1, int x2, int y2);
+void axis_map_curve(int axis, const uint16_t *ent);    // 곡선 교체 (AXIS_MAP_LEN 항목), 재컴파일 없이
+int axis_map_probe(int axis, int val);      // 표 항목 읽어 보기 (-1 = 응답 없음)
+void axis_map_override(uint32_t mask);      // 1인 관절은 펌웨어가 DUTY로 직접 (스톨 되돌림)
+uint32_t axis_map_overridden(void);
+void axis_map_sync(int *const angle[]);     // 매핑 중인 관절의 현재 출력 → 명령 각도
+
+#endif
@@ -0,0 +1,90 @@
+#include "axis_pred.h"
+
+#define AXIS_MAX    4095
+
+static int32_t clamp(int32_t v, int32_t lo, int32_t hi) {
+    if (v < lo) return lo;
+    if (v > hi) return hi;
+    return v;
+}
+
+void axis_pred_init(axis_pred_t *p, int32_t neu_min, int32_t neu_max) {
+    *p = (axis_pred_t){ .neu_min = neu_min, .neu_max = neu_max };
+}
+
+void axis_pred_reset(axis_pred_t *p) {
+    p->have = 0;
+    p->predicting = 0;
+    for (int a = 0; a < AXIS_PRED_AXES; a++) {
+        p->vel[a] = 0;
+        p->offs[a] = 0;
+    }
+}
+
+// 마지막 프레임 뒤 t ms의 예측값: 속도가 HORIZON 동안 선형으로 0까지 줄어든다고 봄
+//   이동량 = v * (t - t^2 / 2H), t >= H 이면 v * H / 2 에서 멈춤
+static int32_t predict(const axis_pred_t *p, int a, uint32_t t) {
+    int32_t last = p->last[a];
+
+    // 중립에서는 예측하지 않고, 움직이던 쪽에서 중립을 넘어 반대로 가지 않음 (중립까지는 허용 = 정지)
+    if (last >= p->neu_min && last <= p->neu_max) return last;
+    if (t > AXIS_PRED_HORIZON_MS) t = AXIS_PRED_HORIZON_MS;
+    int32_t te = (int32_t)t;
+    int32_t v = last + ((p->vel[a] * (te - te * te / (2 * AXIS_PRED_HORIZON_MS))) >> 8);
+    if (last > p->neu_max) return clamp(v, p->neu_min, AXIS_MAX);
+    return clamp(v, 0, p->neu_max);
+}
+
+void axis_pred_frame(axis_pred_t *p, const int32_t *in, uint32_t now_ms, int32_t *out) {
+    uint32_t dt = now_ms - p->last_ms;
+
+    if (p->predicting) {
+        // 끊김 끝: 예측과 실제 차이는 바로 적용하지 않고 틱마다 줄임
+        p->predicting = 0;
+        if (dt > p->max_gap_ms) p->max_gap_ms = dt;
+        for (int a = 0; a < AXIS_PRED_AXES; a++) {
+            if (p->out[a] == p->last[a] && p->offs[a] == 0) continue;   // 이 축은 예측 안 함
+            int32_t err = p->out[a] - in[a];
+            axis_gap_stat_t *s = &p->st[a];
+            s->gaps++;
+            s->last_err = err < 0 ? -err : err;
+            if (s->last_err > s->max_err) s->max_err = s->last_err;
+            p->offs[a] = err;
+        }
+    }
+
+    for (int a = 0; a < AXIS_PRED_AXES; a++) {
+        if (p->have) {
+            int32_t raw = ((in[a] - p->last[a]) << 8) / (int32_t)(dt ? dt : 1);
+            raw = clamp(raw, -(AXIS_PRED_VMAX << 8), AXIS_PRED_VMAX << 8);
+            p->vel[a] = (p->have > 1) ? (p->vel[a] + raw) / 2 : raw;
+        }
+        p->last[a] = in[a];
+        p->out[a] = clamp(in[a] + p->offs[a], 0, AXIS_MAX);
+        out[a] = p->out[a];
+    }
+    p->last_ms = now_ms;
+    if (p->have < 2) p->have++;
+}
+
+int axis_pred_tick(axis_pred_t *p, uint32_t now_ms, int32_t *out) {
+    int changed = 0;
+
+    if (!p->have) return 0;
+    uint32_t elapsed = now_ms - p->last_ms;
+    if (elapsed > AXIS_PRED_GAP_MS) p->predicting = 1;
+
+    for (int a = 0; a < AXIS_PRED_AXES; a++) {
+        int32_t base = p->last[a];
+        if (p->predicting) {
+            base = predict(p, a, elapsed);
+            if (base != p->last[a]) p->st[a].pred_ticks++;
+        }
+        p->offs[a] /= 1 << AXIS_PRED_RESYNC_SHIFT;
+        int32_t v = clamp(base + p->offs[a], 0, AXIS_MAX);
+        if (v != p->out[a]) changed = 1;
+        p->out[a] = v;
+        out[a] = v;
+    }
+    return changed;
+}
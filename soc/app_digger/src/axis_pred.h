@@ -0,0 +1,43 @@
+#ifndef AXIS_PRED_H
+#define AXIS_PRED_H
+
+#include <stdint.h>
+
+// 작업 모드 조이스틱 축 예측 (하드웨어 의존 없음: sim/ 에서 호스트로도 빌드)
+// 블루투스가 잠깐 끊기면 최근 속도로 축 값을 이어 가다가 (속도는 선형으로 줄어 정지),
+// 새 프레임이 오면 예측값과의 차이를 몇 틱에 걸쳐 줄여 튀지 않게 맞춤
+#define AXIS_PRED_AXES      4           // X1, Y1, X2, Y2
+#define AXIS_PRED_GAP_MS    30          // 송신 주기 20ms: 이보다 늦으면 끊긴 것으로 봄
+#define AXIS_PRED_HORIZON_MS 120        // 속도가 0이 되는 시간 (이후는 그 자리 유지)
+#define AXIS_PRED_VMAX      16          // 축 단위/ms: 끝에서 끝까지 약 250ms보다 빠른 추정은 잘라냄
+#define AXIS_PRED_RESYNC_SHIFT 1        // 틱마다 남은 차이를 1/2 로 (20ms 틱 4번이면 1/16)
+
+// 축별 끊김 통계
+typedef struct {
+    uint32_t gaps;          // 이 축이 움직이던 중에 끊긴 횟수
+    uint32_t pred_ticks;    // 예측으로 채운 틱 수
+    uint32_t max_err;       // 새 프레임과 예측의 차이 최대 (축 단위)
+    uint32_t last_err;
+} axis_gap_stat_t;
+
+typedef struct {
+    int32_t neu_min, neu_max;           // 중립 구간: 예측은 중립을 넘어 반대쪽으로 가지 않음
+    int32_t last[AXIS_PRED_AXES];       // 마지막으로 받은 값
+    int32_t vel[AXIS_PRED_AXES];        // Q8 축 단위/ms
+    int32_t out[AXIS_PRED_AXES];        // 마지막 출력
+    int32_t offs[AXIS_PRED_AXES];       // 재동기 중 남은 차이 (출력 - 받은 값)
+    uint32_t last_ms;
+    uint32_t max_gap_ms;                // 가장 길었던 끊김 (모든 축 공통)
+    uint8_t have;                       // 받은 프레임 수 (0, 1, 2 이상)
+    uint8_t predicting;
+    axis_gap_stat_t st[AXIS_PRED_AXES];
+} axis_pred_t;
+
+void axis_pred_init(axis_pred_t *p, int32_t neu_min, int32_t neu_max);
+void axis_pred_reset(axis_pred_t *p);   // 정지/모드 전환: 예측 중단 (통계는 유지)
+// 새 프레임: 속도 추정, 끊김 뒤면 통계 기록 후 재동기 시작. out = 이번에 적용할 값
+void axis_pred_frame(axis_pred_t *p, const int32_t *in, uint32_t now_ms, int32_t *out);
+// 고정 주기 틱: 끊긴 동안 예측, 재동기 차이 감소. 출력이 바뀌었으면 out 채우고 1
+int axis_pred_tick(axis_pred_t *p, uint32_t now_ms, int32_t *out);
+
+#endif
@@ -0,0 +1,14 @@
+#include "cycles.h"
+#include "xil_types.h"
+#include "xpseudo_asm.h"
+
+// 하위를 읽는 사이 상위가 넘어가면 다시 읽음
+uint64_t now_cycles(void) {
+    uint32_t hi, lo;
+
+    do {
+        hi = csrr(XREG_TIMEH);
+        lo = rdtime();
+    } while (hi != csrr(XREG_TIMEH));
+    return ((uint64_t)hi << 32) | lo;
+}
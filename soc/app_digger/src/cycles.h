@@ -0,0 +1,11 @@
+#ifndef CYCLES_H
+#define CYCLES_H
+
+#include <stdint.h>
+#include "xiltimer.h"   // COUNTS_PER_SECOND
+
+// 부팅 후 CPU 사이클 수 (COUNTS_PER_SECOND 단위)
+// BSP 기본 타이머가 MB_RISCV 라 XTime_GetTime 이 없어서 time CSR 을 직접 읽음
+uint64_t now_cycles(void);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef DIGGER_RTOS_H
+#define DIGGER_RTOS_H
+
+#include <stdint.h>
+#include "motion.h"
+#include "mailbox.h"
+#include "playout.h"
+
+// FreeRTOS 도메인으로 빌드하면 우선순위 태스크 구성 (rtos_main.c), 아니면 helloworld.c 슈퍼루프
+// 같은 FreeRTOS 도메인에서 비교용 슈퍼루프가 필요하면 DIGGER_SUPERLOOP 정의
+#if defined(__has_include)
+#if __has_include("FreeRTOS.h") && !defined(DIGGER_SUPERLOOP)
+#define DIGGER_RTOS
+#endif
+#endif
+
+#if defined(DIGGER_RTOS) && defined(MAILBOX_HW)
+#error "FreeRTOS 빌드는 1코어 구성만 (2코어는 코어마다 슈퍼루프)"
+#endif
+
+// helloworld.c: 수신/해석/보고 (두 빌드가 같이 씀)
+extern playout_t link_play;
+void usb_write(const char *str);            // USB UART 로 바로 (바쁜 대기)
+void send_msg(const char *str);             // 디버그 출력 (FreeRTOS: dbg 태스크가 내보냄)
+void rx_byte(uint8_t ch);
+void rx_poll_timeout(void);                 // 잘린 이진 프레임 뒤 바이트 다시 처리
+void link_poll_frame(void);                 // myip_frame_rx 새 프레임 처리 (없으면 빈 함수)
+void report_status(const motion_status_t *st, const playout_stats_t *play);
+uint32_t now_us(void);
+
+#ifdef DIGGER_RTOS
+// rtos_main.c: 해석한 명령을 구동 태스크로 (timed = 송신 시각 있음, 재생 버퍼로)
+void rtos_motion_post(const motion_cmd_t *cmd, int timed, uint32_t tx_ms, uint32_t arrive_us);
+void rtos_debug_write(const char *str);
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+#include "estop.h"
+#include "xil_io.h"
+
+#ifdef ESTOP_HW
+
+#define SYS_CLK_FREQ    100000000
+#define ESTOP_ADDR      XPAR_MYIP_ESTOP_0_BASEADDR
+#define LINK_BAUD       38400       // HC-05 링크 속도 (UART Lite와 같음)
+
+// myip_estop 레지스터 (ip_repo/myip_estop_1_0/regmap.json)
+#define ES_CTRL         0x00
+#define ES_BAUD         0x04
+#define ES_STATUS       0x14
+#define ES_CLEAR        0x18
+#define ES_AGE          0x20
+
+#define ES_CTRL_ENABLE  (1u << 0)
+#define ES_CTRL_TRIP_IN (1u << 2)   // myip_frame_rx 비상정지 버튼 프레임
+#define ES_TRIPPED      (1u << 0)
+
+// 바이트열은 리셋값 "BTN=16" 그대로 (텍스트 링크), 이진 프레임은 trip_in 으로
+// 리셋 직후부터 감시 중이므로 부팅 중에 걸린 것은 지우지 않음
+void estop_init(void) {
+    Xil_Out32(ESTOP_ADDR + ES_BAUD, SYS_CLK_FREQ / (16 * LINK_BAUD));
+    Xil_Out32(ESTOP_ADDR + ES_CTRL, ES_CTRL_ENABLE | ES_CTRL_TRIP_IN);
+}
+
+int estop_tripped(void) {
+    return (Xil_In32(ESTOP_ADDR + ES_STATUS) & ES_TRIPPED) != 0;
+}
+
+uint32_t estop_age_us(void) {
+    return Xil_In32(ESTOP_ADDR + ES_AGE) / (SYS_CLK_FREQ / 1000000);
+}
+
+void estop_clear(void) {
+    Xil_Out32(ESTOP_ADDR + ES_CLEAR, 1);
+}
+
+#else
+
+void estop_init(void) {}
+int estop_tripped(void) { return 0; }
+uint32_t estop_age_us(void) { return 0; }
+void estop_clear(void) {}
+
+#endif
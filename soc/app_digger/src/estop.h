@@ -0,0 +1,17 @@
+#ifndef ESTOP_H
+#define ESTOP_H
+
+#include <stdint.h>
+#include "xparameters.h"
+#include "pwm_out.h"
+
+#if defined(XPAR_MYIP_ESTOP_0_BASEADDR) && defined(PWM_OUT_HW)
+#define ESTOP_HW            // RX 선 비상정지 감시 IP: 바퀴 출력은 CPU보다 먼저 하드웨어가 끊음
+#endif
+
+void estop_init(void);
+int estop_tripped(void);            // 하드웨어 걸림 유지 중이면 1
+uint32_t estop_age_us(void);        // 걸린 뒤 지난 시간
+void estop_clear(void);             // 바퀴 목표를 0으로 만든 뒤에만 호출
+
+#endif
@@ -4,42 +4,66 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "motion.h"
+#include "mailbox.h"
+#include "link_rx.h"
+#include "playout.h"
+#include "digger_rtos.h"
+#include "cycles.h"
 
-// UART 및 PWM 주소 정의
+#ifndef DIGGER_CORE_MOTION  // 2코어 구성의 모션 코어는 motion_core.c
+
+// UART 주소 정의
 #define HC05_UART_DEVICE_ID XPAR_XUARTLITE_0_BASEADDR
 #define USB_UART_BASEADDR   XPAR_XUARTLITE_1_BASEADDR
-#define HANDLE_ADDR         XPAR_MYIP_HANDLE_0_BASEADDR
-
-#define PWM_0_ADDR XPAR_MYIP_PWM_X1_BASEADDR  
-#define PWM_1_ADDR XPAR_MYIP_PWM_Y1_BASEADDR  
-#define PWM_2_ADDR XPAR_MYIP_PWM_X2_BASEADDR  
-#define PWM_3_ADDR XPAR_MYIP_PWM_Y2_BASEADDR  
-#define PWM_5_ADDR XPAR_MYIP_PWM_LEFT_WHEEL_BASEADDR  
-#define PWM_6_ADDR XPAR_MYIP_PWM_RIGHT_WHEEL_BASEADDR  
 
-#define SYS_CLK_FREQ  100000000  
 #define BUFFER_SIZE   256
 #define LINE_SIZE     64
-#define NEUTRAL_MIN   1500  // 조이스틱 중립 구간
-#define NEUTRAL_MAX   2600  // 조이스틱 중립 구간
+#define JOINT_REPORT_TICKS  5       // 100ms마다 조종기로 관절 상태 전송
+#define PLAYOUT_REPORT_TICKS 250    // 5초마다 재생 버퍼 상태 (USB)
+#define RX_FRAME_BODY       (LINK_FRAME_LEN - 2)
+#define RX_FRAME_TIMEOUT_US 50000   // 프레임 도중 이만큼 끊기면 잘린 프레임 (HC-05 가 뭉쳐 보내는 틈보다 길게)
+#ifdef DIGGER_CORE_COMMS
+#define BEAT_CYC            (COUNTS_PER_SECOND / 100)   // 10ms마다 생존 카운터 (모션 코어 감시용)
+#define STATUS_TIMEOUT_CYC  (COUNTS_PER_SECOND / 5)     // 200ms 동안 상태가 안 오면 모션 코어 멈춤
+#endif
 
 XUartLite Uart_HC05;
 
-// 현재 상태 저장
-int x1_angle = 90, y1_angle = 90, x2_angle = 90, y2_angle = 45;
 char line_buf[LINE_SIZE];
 int line_idx = 0;
 int last_x1 = 2048, last_y1 = 2048, last_x2 = 2048, last_y2 = 2048; // 이전값 보관
-int left_speed = 0, right_speed = 0; // 현재 속도
+int link_binary = 0;    // 이진 프레임을 한 번이라도 받으면 텍스트 줄은 무시 (같은 RX 선)
+playout_t link_play;    // 축 명령은 송신 시각 간격대로 재생 (정지/버튼은 바로)
+int rx_frame_left = 0;  // 이진 프레임 안 남은 바이트 (-1 = 동기 첫 바이트 받음): 이 동안은 제어 바이트 아님
+uint8_t rx_frame_buf[LINK_FRAME_LEN - 2];   // 동기 뒤 바이트: CRC가 맞지 않으면 다시 훑음 (잘린 프레임 뒤 제어 바이트)
+uint32_t rx_frame_us;   // 마지막으로 프레임 바이트를 받은 시각
 
 // USB로 디버그 메시지 전송
-void send_msg(const char *str) {
+void usb_write(const char *str) {
     while (*str) {
         while (Xil_In32(USB_UART_BASEADDR + 0x8) & 0x8);
         Xil_Out8(USB_UART_BASEADDR + 0x4, *str++);
     }
 }
 
+// FreeRTOS 빌드는 큐에 넣고 바로 반환 (낮은 우선순위 dbg 태스크가 내보냄)
+void send_msg(const char *str) {
+#ifdef DIGGER_RTOS
+    rtos_debug_write(str);
+#else
+    usb_write(str);
+#endif
+}
+
+// HC-05로 조종기에 전송
+void send_hc05(const char *str) {
+    while (*str) {
+        while (Xil_In32(HC05_UART_DEVICE_ID + 0x8) & 0x8);
+        Xil_Out8(HC05_UART_DEVICE_ID + 0x4, *str++);
+    }
+}
+
 // 문자열에서 값 추출 (파싱 실패시 0 반환)
 int get_value(const char* str, const char* key) {
     char* pos = strstr(str, key);
@@ -60,177 +84,113 @@ int get_btn(const char* str) {
     return atoi(pos + 4);
 }
 
-// DC모터 PWM 설정
-void set_motor(uint32_t addr, int speed) {
-    if (speed > 100) speed = 100;
-    if (speed < 0) speed = 0;
-    
-    uint32_t duty = (4095 * speed) / 100;  
-    uint32_t temp = SYS_CLK_FREQ / 1000 / 4095 / 2; 
-    
-    Xil_Out32(addr, duty);
-    Xil_Out32(addr + 0x4, temp);
-    Xil_Out32(addr + 0x8, 4095);
+uint32_t now_us(void) {
+    return (uint32_t)(now_cycles() / (COUNTS_PER_SECOND / 1000000));
 }
 
-// 서보모터 제어
-void move_servo(uint32_t addr, int *current_angle, int joy_val) {
-    int target = 90; // 중립위치
-    
-    // 조이스틱 값에 따른 각도 계산
-    if (joy_val < NEUTRAL_MIN) {
-        target = 90 + (NEUTRAL_MIN - joy_val) * 90 / NEUTRAL_MIN;
-    } else if (joy_val > NEUTRAL_MAX) {
-        target = 90 - (joy_val - NEUTRAL_MAX) * 90 / (4095 - NEUTRAL_MAX);
-    }
-    
-    if (target < 0) target = 0;
-    if (target > 180) target = 180;
-    
-    // 부드럽게 움직이기 (급작스러운 움직임 방지)
-    if (*current_angle < target) {
-        *current_angle += 3;
-        if (*current_angle > target) *current_angle = target;
-    } else if (*current_angle > target) {
-        *current_angle -= 3;
-        if (*current_angle < target) *current_angle = target;
-    }
-    
-    // 서보모터 PWM 출력 (50Hz)
-    uint32_t duty_min = 4095 * 5 / 200;  
-    uint32_t duty_max = 4095 * 25 / 200; 
-    uint32_t duty = duty_min + ((duty_max - duty_min) * (*current_angle)) / 180;
-    uint32_t temp = SYS_CLK_FREQ / 50 / 4095 / 2;
-    
-    Xil_Out32(addr, duty);
-    Xil_Out32(addr + 0x4, temp);
-    Xil_Out32(addr + 0x8, 4095);
+// 구동부로 명령 전달 (2코어: 메일박스, 1코어: 바로 실행, FreeRTOS: 구동 태스크 큐)
+static void motion_send(const motion_cmd_t *cmd) {
+#ifdef DIGGER_RTOS
+    rtos_motion_post(cmd, 0, 0, 0);
+    return;
+#endif
+    if (cmd->stop) playout_flush(&link_play);   // 밀린 축 명령이 정지 뒤에 나가지 않게
+#ifdef DIGGER_CORE_COMMS
+    // 메시지는 최신 것만 남으므로 정지는 정지 워드에도 남김 (다음 축 명령이 덮어써도 모션 코어가 먼저 세움)
+    mailbox_post(cmd, sizeof(*cmd) / 4);
+    if (cmd->stop) mailbox_stop(cmd->stop);
+#else
+    motion_command(cmd);
+#endif
 }
 
-// Y2 서보 제어 (0~90도만 사용)
-void move_y2_servo(int joy_val) {
-    int target = 45; // 중립 45도
-    
-    if (joy_val < NEUTRAL_MIN) {
-        target = 45 + (NEUTRAL_MIN - joy_val) * 45 / NEUTRAL_MIN;
-    } else if (joy_val > NEUTRAL_MAX) {
-        target = 45 - (joy_val - NEUTRAL_MAX) * 45 / (4095 - NEUTRAL_MAX);
-    }
-    
-    if (target < 0) target = 0;
-    if (target > 90) target = 90;
-    
-    // 부드러운 움직임
-    if (y2_angle < target) {
-        y2_angle += 3;
-        if (y2_angle > target) y2_angle = target;
-    } else if (y2_angle > target) {
-        y2_angle -= 3;
-        if (y2_angle < target) y2_angle = target;
-    }
-    
-    uint32_t duty_min = 4095 * 5 / 200;
-    uint32_t duty_max = 4095 * 25 / 200;
-    uint32_t duty = duty_min + ((duty_max - duty_min) * y2_angle) / 180;
-    uint32_t temp = SYS_CLK_FREQ / 50 / 4095 / 2;
-    
-    Xil_Out32(PWM_3_ADDR, duty);
-    Xil_Out32(PWM_3_ADDR + 0x4, temp);
-    Xil_Out32(PWM_3_ADDR + 0x8, 4095);
+// 송신 시각이 있는 축 명령은 재생 버퍼로
+static void motion_send_at(const motion_cmd_t *cmd, uint32_t tx_ms, uint32_t arrive_us) {
+#ifdef DIGGER_RTOS
+    rtos_motion_post(cmd, 1, tx_ms, arrive_us);
+#else
+    playout_put(&link_play, tx_ms, arrive_us, cmd, sizeof(*cmd) / 4);
+#endif
 }
 
-// 모터 정지
-void stop_motors() {
-    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
-    handle[0] = 0;
-    set_motor(PWM_5_ADDR, 0);
-    set_motor(PWM_6_ADDR, 0);
-    left_speed = 0;
-    right_speed = 0;
-}
+// 관절 주기마다 받은 구동부 상태 보고
+void report_status(const motion_status_t *st, const playout_stats_t *play) {
+    static int report_cnt, play_cnt;
+    static uint32_t last_stall, last_flags;
+    static int32_t last_gaps;
+    char msg[128];
 
-// 바퀴 구동 (점진적 가속/감속)
-void drive_wheels(int y1_val, int y2_val) {
-    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
-    int cmd = 0;
-    int target_left = 0, target_right = 0;
-    
-    // 중립구간 체크
-    if (y1_val >= NEUTRAL_MIN && y1_val <= NEUTRAL_MAX && 
-        y2_val >= NEUTRAL_MIN && y2_val <= NEUTRAL_MAX) {
-        target_left = 0;
-        target_right = 0;
-    } else {
-        // 왼쪽 바퀴
-        if (y1_val > NEUTRAL_MAX) {
-            cmd |= 0x08; // 전진
-            target_left = (y1_val - NEUTRAL_MAX) * 100 / (4095 - NEUTRAL_MAX);
-        } else if (y1_val < NEUTRAL_MIN) {
-            cmd |= 0x04; // 후진
-            target_left = (NEUTRAL_MIN - y1_val) * 100 / NEUTRAL_MIN;
-        }
-        
-        // 오른쪽 바퀴
-        if (y2_val > NEUTRAL_MAX) {
-            cmd |= 0x01; // 전진
-            target_right = (y2_val - NEUTRAL_MAX) * 100 / (4095 - NEUTRAL_MAX);
-        } else if (y2_val < NEUTRAL_MIN) {
-            cmd |= 0x02; // 후진
-            target_right = (NEUTRAL_MIN - y2_val) * 100 / NEUTRAL_MIN;
-        }
-        
-        if (target_left > 100) target_left = 100;
-        if (target_right > 100) target_right = 100;
+    if ((st->flags & ~last_flags) & MOTION_ST_LINK_LOST) send_msg("MOTION LINK LOST, MOTORS STOPPED\r\n");
+    if ((st->flags & ~last_flags) & MOTION_ST_AXIS_MAP) send_msg("JOINT MAP: FABRIC TABLES\r\n");
+    if ((st->flags & ~last_flags) & MOTION_ST_ESTOP) send_msg("HW E-STOP: WHEELS CUT, RELEASE STICKS TO RESUME\r\n");
+    if ((last_flags & ~st->flags) & MOTION_ST_ESTOP) send_msg("HW E-STOP RELEASED\r\n");
+    last_flags = st->flags;
+
+    // 작업 중 링크 끊김을 예측으로 메운 뒤 (축별 횟수 / 재동기 오차 최대)
+    int32_t gaps = st->gap_cnt[0] + st->gap_cnt[1] + st->gap_cnt[2] + st->gap_cnt[3];
+    if (gaps != last_gaps) {
+        last_gaps = gaps;
+        snprintf(msg, sizeof(msg), "LINK GAP MAX=%dms N=%d,%d,%d,%d ERR=%d,%d,%d,%d\r\n", (int)st->gap_ms,
+            (int)st->gap_cnt[0], (int)st->gap_cnt[1], (int)st->gap_cnt[2], (int)st->gap_cnt[3],
+            (int)st->gap_err[0], (int)st->gap_err[1], (int)st->gap_err[2], (int)st->gap_err[3]);
+        send_msg(msg);
     }
-    
-    // 점진적 가속/감속 (급작스러운 속도변화 방지)
-    if (left_speed < target_left) {
-        left_speed += 10;
-        if (left_speed > target_left) left_speed = target_left;
-    } else if (left_speed > target_left) {
-        left_speed -= 10;
-        if (left_speed < target_left) left_speed = target_left;
+    // 재생 버퍼: 지금 지연, 최근 흔들림, 늦게 온 프레임 / 버린 명령
+    if (++play_cnt >= PLAYOUT_REPORT_TICKS && play->frames) {
+        play_cnt = 0;
+        snprintf(msg, sizeof(msg), "PLAYOUT D=%uus J=%uus MAXJ=%uus N=%u LATE=%u DROP=%u\r\n",
+            (unsigned)play->delay_us, (unsigned)play->jitter_us, (unsigned)play->max_jitter_us,
+            (unsigned)play->frames, (unsigned)play->late, (unsigned)play->dropped);
+        send_msg(msg);
     }
-    
-    if (right_speed < target_right) {
-        right_speed += 10;
-        if (right_speed > target_right) right_speed = target_right;
-    } else if (right_speed > target_right) {
-        right_speed -= 10;
-        if (right_speed < target_right) right_speed = target_right;
+    if (!(st->flags & MOTION_ST_JOINT_FB)) return;
+
+    if (st->stall & ~last_stall) send_msg("JOINT STALL, BACKING OFF\r\n");
+    last_stall = st->stall;
+
+    // 실제 관절 상태: A=측정 각도 (-1 = 아직 없음), R=ADC 값, STALL=관절 비트
+    if (++report_cnt >= JOINT_REPORT_TICKS) {
+        report_cnt = 0;
+        snprintf(msg, sizeof(msg), "JOINT A=%d,%d,%d,%d R=%d,%d,%d,%d STALL=%u\n",
+            (int)st->meas[0], (int)st->meas[1], (int)st->meas[2], (int)st->meas[3],
+            (int)st->raw[0], (int)st->raw[1], (int)st->raw[2], (int)st->raw[3],
+            (unsigned)st->stall);
+        send_hc05(msg);
+    }
+}
+
+// 버튼 처리
+static void apply_btn(int btn) {
+    static const motion_cmd_t stop_cmd = { .stop = MOTION_STOP_ESTOP };
+
+    switch(btn) {
+        case 1: send_msg("BUCKET DOWN\r\n"); break;
+        case 2: send_msg("WORK MODE\r\n"); break;
+        case 4: send_msg("DRIVE MODE\r\n"); break;
+        case 8: send_msg("BUCKET UP\r\n"); break;
+        case 16: 
+            motion_send(&stop_cmd);
+            send_msg("EMERGENCY STOP!\r\n");
+            break;
     }
-    
-    // 모터 제어 출력
-    handle[0] = cmd;
-    set_motor(PWM_5_ADDR, left_speed);
-    set_motor(PWM_6_ADDR, right_speed);
 }
 
 // 받은 데이터 처리
 void process_data(const char* line) {
+    static const motion_cmd_t stop_cmd = { .stop = MOTION_STOP_NEUTRAL };
+
     if (strlen(line) < 10) return; // 너무 짧으면 무시
     
     // 버튼 처리
     if (strstr(line, "BTN=")) {
         int btn = get_btn(line);
-        if (btn > 0) {
-            switch(btn) {
-                case 1: send_msg("BUCKET DOWN\r\n"); break;
-                case 2: send_msg("WORK MODE\r\n"); break;
-                case 4: send_msg("DRIVE MODE\r\n"); break;
-                case 8: send_msg("BUCKET UP\r\n"); break;
-                case 16: 
-                    stop_motors();
-                    send_msg("EMERGENCY STOP!\r\n");
-                    break;
-            }
-        }
+        if (btn > 0) apply_btn(btn);
         return;
     }
     
     // 중립 명령 처리
     if (strstr(line, "NEUTRAL=1")) {
-        stop_motors();
+        motion_send(&stop_cmd);
         return;
     }
     
@@ -249,26 +209,122 @@ void process_data(const char* line) {
     if (x2 > 0) last_x2 = x2; else x2 = last_x2;
     if (y2 > 0) last_y2 = y2; else y2 = last_y2;
     
-    // 모드별 제어
-    if (mode == 1) {  // 작업 모드
-        // 중립 체크 (불필요한 동작 방지)
-        if (x1 >= NEUTRAL_MIN && x1 <= NEUTRAL_MAX &&
-            y1 >= NEUTRAL_MIN && y1 <= NEUTRAL_MAX &&
-            x2 >= NEUTRAL_MIN && x2 <= NEUTRAL_MAX &&
-            y2 >= NEUTRAL_MIN && y2 <= NEUTRAL_MAX) {
-            return; // 중립이면 아무것도 안함
+    motion_cmd_t cmd = { .mode = mode, .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
+    char *t = strstr(line, " T=");
+    if (t) motion_send_at(&cmd, strtoul(t + 3, NULL, 10), now_us());
+    else motion_send(&cmd);     // 송신 시각 없는 예전 조종기
+}
+
+#ifdef LINK_RX_HW
+// CRC까지 확인된 프레임 처리 (값은 이미 검증됐으므로 이전값 대체 없음)
+static void process_frame(const link_frame_t *f) {
+    static const motion_cmd_t stop_cmd = { .stop = MOTION_STOP_NEUTRAL };
+
+    if (f->btn) {
+        apply_btn(f->btn);
+        return;
+    }
+    if (f->flags & LINK_FLAG_NEUTRAL) {
+        motion_send(&stop_cmd);
+        return;
+    }
+    if (!(f->flags & LINK_FLAG_AXES) || f->mode == 0) return;
+    if (f->x1 > 4095 || f->y1 > 4095 || f->x2 > 4095 || f->y2 > 4095) return;
+
+    last_x1 = f->x1;
+    last_y1 = f->y1;
+    last_x2 = f->x2;
+    last_y2 = f->y2;
+    motion_cmd_t cmd = { .mode = f->mode, .x1 = f->x1, .y1 = f->y1, .x2 = f->x2, .y2 = f->y2 };
+    motion_send_at(&cmd, f->tx_ms, now_us() - f->age_us);   // 도착 = IP가 CRC 확인한 시각
+}
+#endif
+
+// 대역 외 제어 바이트: 받다 만 줄은 이전 모드/상태 기준이라 버림
+static void process_oob(uint8_t code) {
+    line_idx = 0;
+    switch (code) {
+        case LINK_OOB_ESTOP: apply_btn(16); break;
+        case LINK_OOB_WORK:  apply_btn(2); break;
+        case LINK_OOB_DRIVE: apply_btn(4); break;
+    }
+}
+
+// 프레임으로 보고 모아 둔 바이트를 처음부터 다시 처리 (프레임이 아니었음)
+static void rx_rescan(int n) {
+    uint8_t b[RX_FRAME_BODY];
+
+    memcpy(b, rx_frame_buf, n);
+    rx_frame_left = 0;
+    for (int i = 0; i < n; i++) {
+        rx_byte(b[i]);
+    }
+}
+
+// RX 바이트 하나: 제어 바이트 > 이진 프레임 건너뛰기 (IP가 처리) > 텍스트 줄
+// 프레임 안 바이트는 모아 두고 CRC가 맞을 때만 버림: 잘리거나 깨진 프레임, 텍스트 속 A5 5A 뒤의 제어 바이트도 처리됨
+void rx_byte(uint8_t ch) {
+    if (rx_frame_left > 0) {
+        rx_frame_buf[RX_FRAME_BODY - rx_frame_left] = ch;
+        rx_frame_us = now_us();
+        if (--rx_frame_left == 0) {
+            uint16_t crc = ((uint16_t)rx_frame_buf[RX_FRAME_BODY - 2] << 8) | rx_frame_buf[RX_FRAME_BODY - 1];
+            if (link_crc16(rx_frame_buf, RX_FRAME_BODY - 2) != crc) rx_rescan(RX_FRAME_BODY);
+        }
+        return;
+    }
+    if (rx_frame_left < 0) {
+        rx_frame_left = 0;
+        if (ch == LINK_SYNC1) {
+            rx_frame_left = RX_FRAME_BODY;
+            rx_frame_us = now_us();
+            return;
         }
-        
-        move_servo(PWM_0_ADDR, &x1_angle, x1);  
-        move_servo(PWM_1_ADDR, &y1_angle, y1);
-        move_servo(PWM_2_ADDR, &x2_angle, x2);
-        move_y2_servo(y2);  
     }
-    else if (mode == 2) {  // 운전 모드
-        drive_wheels(y1, y2);
+    if (ch == LINK_SYNC0) {
+        rx_frame_left = -1;
     }
+    else if (ch == LINK_OOB_ESTOP || ch == LINK_OOB_WORK || ch == LINK_OOB_DRIVE) {
+        process_oob(ch);
+    }
+    else if (ch == '\n') {  // 한 줄 완료
+        if (line_idx > 0 && !link_binary) {
+            line_buf[line_idx] = '\0';
+            process_data(line_buf); // 데이터 처리
+        }
+        line_idx = 0; // 버퍼 리셋
+    }
+    else if (ch >= 32 && ch <= 126) {  // 일반 문자만
+        if (line_idx < LINE_SIZE - 1) {
+            line_buf[line_idx++] = ch;
+        } else {
+            // 버퍼 오버플로우 방지
+            line_idx = 0;
+        }
+    }
+}
+
+// 프레임 도중 바이트가 끊겼으면 (송신부 멈춤) 모아 둔 바이트를 다시 훑음
+void rx_poll_timeout(void) {
+    if (rx_frame_left > 0 && now_us() - rx_frame_us > RX_FRAME_TIMEOUT_US) {
+        rx_rescan(RX_FRAME_BODY - rx_frame_left);
+    }
+}
+
+// 동기/CRC는 IP가 확인, 여기서는 고정된 프레임만 읽음
+void link_poll_frame(void) {
+#ifdef LINK_RX_HW
+    link_frame_t frame;
+    if (link_rx_take(&frame)) {
+        if (!link_binary) send_msg("LINK: BINARY FRAMES\r\n");
+        link_binary = 1;
+        process_frame(&frame);
+    }
+#endif
 }
 
+#ifndef DIGGER_RTOS     // FreeRTOS 빌드의 main 은 rtos_main.c
+
 int main(void) {
     // UART 초기화
     if (XUartLite_Initialize(&Uart_HC05, HC05_UART_DEVICE_ID) != XST_SUCCESS) {
@@ -277,12 +333,23 @@ int main(void) {
     
     send_msg("System Start!\r\n");
     
-    // 모터 안전 초기화
-    set_motor(PWM_5_ADDR, 0);  
-    set_motor(PWM_6_ADDR, 0); 
-    
-    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
-    handle[0] = 0;
+#ifdef DIGGER_CORE_COMMS
+    // 구동부는 모션 코어가 초기화, 여기서는 메일박스만
+    mailbox_init();
+    uint64_t now = now_cycles(), next_beat, last_status;
+    next_beat = now;
+    last_status = now;
+    int motion_lost = 0;
+#else
+    motion_init();
+#endif
+#ifdef LINK_RX_HW
+    link_rx_init();
+#endif
+    motion_status_t st;
+    playout_stats_t play_st;
+    motion_cmd_t play_cmd;
+    playout_init(&link_play, PLAYOUT_TARGET_MS);
     
     send_msg("System Ready!\r\n");
     
@@ -291,29 +358,44 @@ int main(void) {
     line_idx = 0;
     
     while (1) {
+#ifdef DIGGER_CORE_COMMS
+        now = now_cycles();
+        if (now >= next_beat) {
+            mailbox_beat();
+            next_beat = now + BEAT_CYC;
+        }
+        if (mailbox_take(&st, sizeof(st) / 4)) {
+            last_status = now;
+            motion_lost = 0;
+            playout_stats(&link_play, &play_st);
+            report_status(&st, &play_st);
+        }
+        else if (!motion_lost && now - last_status > STATUS_TIMEOUT_CYC) {
+            motion_lost = 1;
+            send_msg("MOTION CORE NOT RESPONDING\r\n");
+        }
+#else
+        if (motion_poll()) {
+            motion_status(&st);
+            playout_stats(&link_play, &play_st);
+            report_status(&st, &play_st);
+        }
+#endif
+        link_poll_frame();
+        rx_poll_timeout();
+        // 재생 시각이 된 축 명령
+        while (playout_take(&link_play, now_us(), &play_cmd, sizeof(play_cmd) / 4)) {
+            motion_send(&play_cmd);
+        }
+        // 제어 바이트는 받은 자리에서 바로 처리, 줄은 '\n' 에서
         int count = XUartLite_Recv(&Uart_HC05, buffer, BUFFER_SIZE);
-        
-        if (count > 0) {
-            for (int i = 0; i < count; i++) {
-                char ch = buffer[i];
-                
-                if (ch == '\n') {  // 한 줄 완료
-                    if (line_idx > 0) {
-                        line_buf[line_idx] = '\0';
-                        process_data(line_buf); // 데이터 처리
-                    }
-                    line_idx = 0; // 버퍼 리셋
-                }
-                else if (ch >= 32 && ch <= 126) {  // 일반 문자만
-                    if (line_idx < LINE_SIZE - 1) {
-                        line_buf[line_idx++] = ch;
-                    } else {
-                        // 버퍼 오버플로우 방지
-                        line_idx = 0;
-                    }
-                }
-            }
+        for (int i = 0; i < count; i++) {
+            rx_byte(buffer[i]);
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+#include "joint_fb.h"
+#include "xil_io.h"
+
+joint_state_t joint_state[JOINT_COUNT];
+
+#ifdef JOINT_FB_HW
+
+#define SERVO_FB_ADDR       XPAR_MYIP_SERVO_FB_0_BASEADDR
+#define SFB_CTRL            0x00
+#define SFB_JOINT(j)        (0x10 + (j) * 4)
+#define SFB_VALID           0x80000000u
+
+#ifdef JOINT_CAL_PINNED
+static const uint16_t joint_cal[JOINT_COUNT][2] = JOINT_CAL_PINNED;
+#else
+static const uint16_t joint_cal[JOINT_COUNT][2] = {{400, 3700}, {400, 3700}, {400, 3700}, {400, 3700}};
+#endif
+static uint32_t joint_scale[JOINT_COUNT];   // Q16 도/LSB (나눗셈은 init에서 한 번)
+
+static const int joint_max[JOINT_COUNT] = { 180, 180, 180, 90 };   // Y2는 0~90도만 사용
+
+static int read_angle(int j)
+{
+    uint32_t v = Xil_In32(SERVO_FB_ADDR + SFB_JOINT(j));
+    if (!(v & SFB_VALID)) return -1;
+
+    int raw = v & 0xFFF;
+    joint_state[j].raw = raw;
+    if (raw <= joint_cal[j][0]) return 0;
+    int deg = (int)(((uint32_t)(raw - joint_cal[j][0]) * joint_scale[j]) >> 16);
+    return deg > 180 ? 180 : deg;
+}
+
+void joint_fb_init(void)
+{
+    for (int j = 0; j < JOINT_COUNT; j++) {
+        uint32_t span = joint_cal[j][1] - joint_cal[j][0];
+        joint_scale[j] = ((180u << 16) + span / 2) / span;
+        joint_state[j] = (joint_state_t){ .meas = -1, .cmd = -1 };
+    }
+    Xil_Out32(SERVO_FB_ADDR + SFB_CTRL, 1);
+}
+
+int joint_fb_limit(int j, int angle)
+{
+    joint_state_t *s = &joint_state[j];
+    if (!s->stalled) return angle;
+
+    // 반대로 충분히 돌아오면 해제, 아니면 막힌 쪽으로는 스톨 위치까지만
+    if (s->stall_dir > 0) {
+        if (angle <= s->stall_at - JOINT_RELEASE_DEG) s->stalled = 0;
+        else if (angle > s->stall_at) angle = s->stall_at;
+    } else {
+        if (angle >= s->stall_at + JOINT_RELEASE_DEG) s->stalled = 0;
+        else if (angle < s->stall_at) angle = s->stall_at;
+    }
+    return angle;
+}
+
+// JOINT_TICK_MS 마다 호출
+uint32_t joint_fb_tick(int *const angle[])
+{
+    uint32_t changed = 0;
+
+    for (int j = 0; j < JOINT_COUNT; j++) {
+        joint_state_t *s = &joint_state[j];
+        int meas = read_angle(j);
+        int cmd = *angle[j];
+
+        s->meas = meas;
+        s->cmd = cmd;
+        if (meas < 0 || s->stalled) {
+            s->slow_ticks = 0;
+            continue;
+        }
+
+        int err = cmd - meas;
+        if (err > -JOINT_ERR_DEG && err < JOINT_ERR_DEG) {
+            s->slow_ticks = 0;
+            continue;
+        }
+
+        // 명령 쪽으로 움직이고 있으면 정상 (서보 슬루 중)
+        if (s->slow_ticks == 0) s->win_start = meas;
+        int moved = (err > 0) ? meas - s->win_start : s->win_start - meas;
+        if (moved >= JOINT_MOVE_DEG) {
+            s->slow_ticks = 0;
+            continue;
+        }
+        if (++s->slow_ticks < JOINT_STALL_TICKS) continue;
+
+        // 스톨: 측정 위치에서 조금 되돌려 서보가 계속 힘을 쓰지 않게
+        int back = (err > 0) ? meas - JOINT_BACKOFF_DEG : meas + JOINT_BACKOFF_DEG;
+        if (back < 0) back = 0;
+        if (back > joint_max[j]) back = joint_max[j];
+        s->stalled = 1;
+        s->stall_dir = (err > 0) ? 1 : -1;
+        s->stall_at = back;
+        s->slow_ticks = 0;
+        *angle[j] = back;
+        changed |= 1u << j;
+    }
+    return changed;
+}
+
+#else
+
+void joint_fb_init(void)
+{
+    for (int j = 0; j < JOINT_COUNT; j++) joint_state[j] = (joint_state_t){ .meas = -1, .cmd = -1 };
+}
+
+int joint_fb_limit(int j, int angle)
+{
+    (void)j;
+    return angle;
+}
+
+uint32_t joint_fb_tick(int *const angle[])
+{
+    (void)angle;
+    return 0;
+}
+
+#endif
+
+uint32_t joint_fb_stall_mask(void)
+{
+    uint32_t mask = 0;
+    for (int j = 0; j < JOINT_COUNT; j++) {
+        if (joint_state[j].stalled) mask |= 1u << j;
+    }
+    return mask;
+}
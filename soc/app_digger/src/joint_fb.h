@@ -0,0 +1,41 @@
+#ifndef JOINT_FB_H
+#define JOINT_FB_H
+
+#include <stdint.h>
+#include "xparameters.h"
+
+#ifdef XPAR_MYIP_SERVO_FB_0_BASEADDR
+#define JOINT_FB_HW         // 서보 포텐셔미터 IP 있음 (없으면 관절은 개루프)
+#endif
+
+#define JOINT_COUNT         4       // PWM_CH_X1 ~ PWM_CH_Y2 와 같은 순서
+#define JOINT_TICK_MS       20      // 서보 PWM 주기와 같음
+#define JOINT_ERR_DEG       8       // 명령과 이만큼 차이 나면 추종 중으로 봄
+#define JOINT_MOVE_DEG      2       // 스톨 판정 구간 동안 이보다 덜 움직이면 막힌 것
+#define JOINT_STALL_TICKS   15      // 300ms 동안 못 따라가면 스톨
+#define JOINT_BACKOFF_DEG   5       // 스톨 시 측정 위치에서 이만큼 되돌림
+#define JOINT_RELEASE_DEG   3       // 명령이 스톨 위치에서 반대로 이만큼 돌아오면 해제
+
+// 관절별 포텐셔미터 보정: 0도/180도에서의 ADC 값 (서보마다 다름)
+// 서보를 0도/180도로 보낸 뒤 JOINT 상태 줄의 R= 값을 적어 사용
+// 예) #define JOINT_CAL_PINNED {{410,3690},{395,3702},{420,3671},{405,3688}}
+
+typedef struct {
+    int16_t raw;        // 포텐셔미터 ADC 값
+    int16_t meas;       // 측정 각도 (도), 측정 전이면 -1
+    int16_t cmd;        // 마지막으로 본 명령 각도
+    uint8_t stalled;
+    int8_t stall_dir;   // 막힌 방향 (+1 각도 증가 / -1 감소)
+    int16_t stall_at;   // 이 각도를 넘는 명령은 막힘 방향으로 못 감
+    uint8_t slow_ticks; // 못 따라간 연속 틱 수
+    int16_t win_start;  // 판정 구간 시작 시 측정 각도
+} joint_state_t;
+
+extern joint_state_t joint_state[JOINT_COUNT];
+
+void joint_fb_init(void);
+int joint_fb_limit(int j, int angle);       // 새 명령 각도를 스톨 상태에 맞게 제한
+uint32_t joint_fb_tick(int *const angle[]); // 측정 vs 명령, 스톨이면 명령을 되돌림. 바꾼 관절 비트 반환
+uint32_t joint_fb_stall_mask(void);
+
+#endif
@@ -0,0 +1,73 @@
+#include "link_rx.h"
+#include "xil_io.h"
+
+uint16_t link_crc16(const uint8_t *p, int len) {
+    uint16_t crc = 0xFFFF;
+
+    while (len--) {
+        crc ^= (uint16_t)*p++ << 8;
+        for (int k = 0; k < 8; k++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+#ifdef LINK_RX_HW
+
+#define SYS_CLK_FREQ    100000000
+#define LINK_ADDR       XPAR_MYIP_FRAME_RX_0_BASEADDR
+#define LINK_BAUD       38400       // HC-05 링크 속도 (UART Lite와 같음)
+
+// myip_frame_rx 레지스터 (ip_repo/myip_frame_rx_1_0/regmap.json)
+#define FRX_CTRL        0x00
+#define FRX_BAUD        0x04
+#define FRX_GAP         0x08
+#define FRX_ERRS        0x14
+#define FRX_SEQ         0x18
+#define FRX_STAMP       0x1C
+#define FRX_FRAME(n)    (0x20 + (n) * 4)
+#define FRX_NOW         0x2C
+#define FRX_FRAME3      0x30
+
+#define FRX_GAP_TICKS   (SYS_CLK_FREQ / LINK_BAUD * 10 * 3)   // 프레임 중 3바이트 시간 끊기면 버림
+
+static uint32_t last_seq;
+
+void link_rx_init(void) {
+    Xil_Out32(LINK_ADDR + FRX_CTRL, 0);
+    Xil_Out32(LINK_ADDR + FRX_BAUD, SYS_CLK_FREQ / (16 * LINK_BAUD));
+    Xil_Out32(LINK_ADDR + FRX_GAP, FRX_GAP_TICKS);
+    last_seq = Xil_In32(LINK_ADDR + FRX_SEQ) & 0xFFFF;
+    Xil_Out32(LINK_ADDR + FRX_CTRL, 0x1);
+}
+
+// SEQ 읽기 한 번으로 최신 프레임이 고정되므로 나머지는 그냥 읽으면 됨
+int link_rx_take(link_frame_t *f) {
+    uint32_t seq = Xil_In32(LINK_ADDR + FRX_SEQ) & 0xFFFF;
+    if (seq == 0 || seq == last_seq) return 0;
+    last_seq = seq;
+
+    uint32_t w0 = Xil_In32(LINK_ADDR + FRX_FRAME(0));
+    uint32_t w1 = Xil_In32(LINK_ADDR + FRX_FRAME(1));
+    uint32_t w2 = Xil_In32(LINK_ADDR + FRX_FRAME(2));
+    uint32_t w3 = Xil_In32(LINK_ADDR + FRX_FRAME3);
+    uint32_t age = Xil_In32(LINK_ADDR + FRX_NOW) - Xil_In32(LINK_ADDR + FRX_STAMP);
+
+    f->tx_seq = w0 & 0xFF;
+    f->mode = (w0 >> 8) & 0xFF;
+    f->btn = (w0 >> 16) & 0xFF;
+    f->flags = w0 >> 24;
+    f->x1 = w1 & 0xFFFF;
+    f->y1 = w1 >> 16;
+    f->x2 = w2 & 0xFFFF;
+    f->y2 = w2 >> 16;
+    f->tx_ms = w3;
+    f->age_us = age / (SYS_CLK_FREQ / 1000000);
+    return 1;
+}
+
+uint32_t link_rx_errors(void) {
+    return Xil_In32(LINK_ADDR + FRX_ERRS);
+}
+
+#endif
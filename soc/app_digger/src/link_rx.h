@@ -0,0 +1,41 @@
+#ifndef LINK_RX_H
+#define LINK_RX_H
+
+#include <stdint.h>
+#include "xparameters.h"
+
+#ifdef XPAR_MYIP_FRAME_RX_0_BASEADDR
+#define LINK_RX_HW          // 조종기 이진 프레임을 IP가 동기/CRC 확인까지 처리 (없으면 텍스트 줄만)
+#endif
+
+// 조종기 프레임 페이로드 (myip_frame_rx.h 의 프레임 형식과 같음)
+#define LINK_FLAG_NEUTRAL   (1u << 0)   // 중립 (모터 정지)
+#define LINK_FLAG_AXES      (1u << 1)   // X1~Y2 유효
+#define LINK_FRAME_LEN      20
+#define LINK_SYNC0          0xA5
+#define LINK_SYNC1          0x5A
+
+// 대역 외 제어 바이트 (app_lcd_jy link_tx.h 와 같음): 줄/프레임 사이 어디서든 한 바이트로 바로 처리
+// 출력 가능 문자 밖이라 텍스트 줄에는 안 나오고, 예전 수신부는 그냥 버림
+#define LINK_OOB_ESTOP      0x1C
+#define LINK_OOB_WORK       0x1D
+#define LINK_OOB_DRIVE      0x1E
+
+typedef struct {
+    uint8_t tx_seq;     // 송신 번호 (빠진 프레임 확인용)
+    uint8_t mode;
+    uint8_t btn;        // 버튼 비트 (텍스트 BTN= 값과 같음)
+    uint8_t flags;
+    uint16_t x1, y1, x2, y2;
+    uint32_t tx_ms;     // 송신 시각 (조종기 시계)
+    uint32_t age_us;    // CRC 확인부터 읽을 때까지 걸린 시간
+} link_frame_t;
+
+// CRC-16/CCITT-FALSE (app_lcd_jy link_tx.c, myip_frame_rx 와 같음)
+uint16_t link_crc16(const uint8_t *p, int len);
+
+void link_rx_init(void);
+int link_rx_take(link_frame_t *f);      // 새 프레임이 있으면 채우고 1
+uint32_t link_rx_errors(void);          // [15:0] CRC 오류, [31:16] 프레이밍/간격 오류
+
+#endif
@@ -0,0 +1,99 @@
+#include "mailbox.h"
+#include "xil_io.h"
+
+#ifdef MAILBOX_HW
+
+#define MBOX_ADDR       XPAR_MYIP_MAILBOX_0_BASEADDR
+
+// myip_mailbox 레지스터 (ip_repo/myip_mailbox_1_0/regmap.json)
+#define MBOX_BLK(n)     ((n) * 0x80)
+#define MBOX_WORDS      32
+#define MBOX_DOORBELL   0x100
+#define MBOX_INFO       0x10C
+
+#define MBOX_SEQ        0                   // 시퀀스 워드
+#define MBOX_STOP       (MBOX_WORDS - 2)    // [31:8] 정지 카운터, [7:0] 종류 (시퀀스 밖, 단일 워드)
+#define MBOX_BEAT       (MBOX_WORDS - 1)    // 생존 카운터 (시퀀스 밖, 단일 워드라 찢어지지 않음)
+#define MBOX_RETRY      4                   // 쓰는 중이면 다시 읽는 횟수
+
+static uint32_t own_blk, peer_blk;
+static uint32_t tx_seq;     // 마지막으로 쓴 시퀀스 (짝수)
+static uint32_t rx_seq;     // 마지막으로 받은 상대 시퀀스
+static uint32_t beat;
+static uint32_t tx_stop;    // 마지막으로 쓴 정지 워드
+static uint32_t rx_stop;    // 마지막으로 본 상대 정지 워드
+
+static inline uint32_t blk_rd(uint32_t blk, int w) {
+    return Xil_In32(MBOX_ADDR + blk + w * 4);
+}
+
+static inline void blk_wr(int w, uint32_t v) {
+    Xil_Out32(MBOX_ADDR + own_blk + w * 4, v);
+}
+
+void mailbox_init(void) {
+    uint32_t port = Xil_In32(MBOX_ADDR + MBOX_INFO) & 0x1;
+    own_blk = MBOX_BLK(port);
+    peer_blk = MBOX_BLK(port ^ 1);
+
+    // 이 코어만 다시 시작해도 시퀀스를 이어감 (쓰다 만 홀수 값은 다음 메시지가 마무리)
+    tx_seq = blk_rd(own_blk, MBOX_SEQ) & ~1u;
+    beat = blk_rd(own_blk, MBOX_BEAT);
+    tx_stop = blk_rd(own_blk, MBOX_STOP);
+    rx_seq = blk_rd(peer_blk, MBOX_SEQ) & ~1u;  // 시작 전에 있던 메시지는 무시
+    rx_stop = blk_rd(peer_blk, MBOX_STOP);      // 시작할 때 구동부는 이미 서 있음
+}
+
+void mailbox_post(const void *msg, int words) {
+    const uint32_t *m = msg;
+
+    blk_wr(MBOX_SEQ, ++tx_seq);         // 홀수: 읽는 쪽은 다시 시도
+    __sync_synchronize();
+    for (int i = 0; i < words; i++) blk_wr(1 + i, m[i]);
+    __sync_synchronize();
+    blk_wr(MBOX_SEQ, ++tx_seq);         // 짝수: 완료
+    Xil_Out32(MBOX_ADDR + MBOX_DOORBELL, 1);
+}
+
+int mailbox_take(void *msg, int words) {
+    uint32_t *m = msg;
+
+    for (int t = 0; t < MBOX_RETRY; t++) {
+        uint32_t s0 = blk_rd(peer_blk, MBOX_SEQ);
+        if (s0 == rx_seq) return 0;     // 새 메시지 없음
+        if (s0 & 1) continue;
+        __sync_synchronize();
+        for (int i = 0; i < words; i++) m[i] = blk_rd(peer_blk, 1 + i);
+        __sync_synchronize();
+        if (blk_rd(peer_blk, MBOX_SEQ) == s0) {
+            rx_seq = s0;
+            return 1;
+        }
+    }
+    return 0;   // 계속 쓰는 중: 다음 호출에서 다시 읽음
+}
+
+void mailbox_beat(void) {
+    blk_wr(MBOX_BEAT, ++beat);
+}
+
+uint32_t mailbox_peer_beat(void) {
+    return blk_rd(peer_blk, MBOX_BEAT);
+}
+
+// 정지 메시지 다음에 씀: 받는 쪽이 정지 워드를 보고 나서 그보다 오래된 메시지를 꺼내는 일이 없음
+void mailbox_stop(uint32_t kind) {
+    tx_stop = (tx_stop & ~0xFFu) + 0x100 + (kind & 0xFF);
+    __sync_synchronize();
+    blk_wr(MBOX_STOP, tx_stop);
+    Xil_Out32(MBOX_ADDR + MBOX_DOORBELL, 1);
+}
+
+uint32_t mailbox_take_stop(void) {
+    uint32_t w = blk_rd(peer_blk, MBOX_STOP);
+    if (w == rx_stop) return 0;
+    rx_stop = w;
+    return w & 0xFF;
+}
+
+#endif
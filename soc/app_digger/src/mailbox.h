@@ -0,0 +1,31 @@
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#include <stdint.h>
+#include "xparameters.h"
+#include "pwm_out.h"
+
+// 2코어 구성: 통신 코어(UART/파싱) <-> 모션 코어(PWM/H-bridge/엔코더) 사이 myip_mailbox
+// 각 코어는 자기 포트의 블록에만 쓰고 상대 블록을 읽음. 포트 번호는 INFO 레지스터로 확인
+// 메시지는 시퀀스 잠금: 블록 워드 0 = 시퀀스 (홀수 = 쓰는 중), 마지막 워드 = 생존 카운터
+// 메시지는 최신 것만 남으므로 정지는 따로 정지 워드(카운터 + 종류)에도 남김: 뒤 메시지가 덮어써도 안 없어짐
+#ifdef XPAR_MYIP_MAILBOX_0_BASEADDR
+#define MAILBOX_HW
+#ifdef PWM_OUT_HW
+#define DIGGER_CORE_MOTION  // 구동부 주변장치가 보이는 코어
+#else
+#define DIGGER_CORE_COMMS   // 구동부는 메일박스 너머에 있음
+#endif
+#endif
+
+#define MAILBOX_MSG_WORDS   29      // 시퀀스/정지/생존 카운터 워드를 뺀 메시지 최대 크기
+
+void mailbox_init(void);
+void mailbox_post(const void *msg, int words);  // 자기 블록에 메시지 쓰고 상대 초인종
+int mailbox_take(void *msg, int words);         // 상대 블록에 새 메시지가 있으면 복사하고 1
+void mailbox_beat(void);                        // 생존 카운터 증가
+uint32_t mailbox_peer_beat(void);               // 상대 생존 카운터
+void mailbox_stop(uint32_t kind);               // 정지 워드 갱신 (정지 메시지를 post 한 뒤에 부름)
+uint32_t mailbox_take_stop(void);               // 상대가 새 정지를 남겼으면 그 종류, 없으면 0
+
+#endif
@@ -0,0 +1,442 @@
+#include "motion.h"
+#include "pwm_out.h"
+#include "axis_map.h"
+#include "estop.h"
+#include "axis_pred.h"
+
+#ifdef PWM_OUT_HW
+#include "xparameters.h"
+#include "xil_io.h"
+#include "wheel_enc.h"
+#include "wheel_ctl.h"
+#include "cycles.h"
+
+#ifdef XPAR_MYIP_HBRIDGE_0_BASEADDR
+// 통합 H-bridge: 부호 있는 속도 한 번 쓰기로 방향 + duty 동시 변경, dead-time/가감속은 하드웨어
+#define HBRIDGE_ADDR        XPAR_MYIP_HBRIDGE_0_BASEADDR
+#define HB_PERIOD_TICKS     5000    // 100MHz / 5000 = 20kHz (가청 대역 밖)
+#define HB_TICKS_PER_PCT    (HB_PERIOD_TICKS / 100)
+#define HB_DEADTIME_TICKS   200     // 방향 전환 시 2us 동안 출력 끔
+#ifdef WHEEL_ENC_HW
+#define HB_ACCEL_TICKS      0       // 폐루프: 가감속은 wheel_tick()의 목표 램프가 담당
+#else
+#define HB_ACCEL_TICKS      1       // 주기(50us)당 1틱: 0 -> 100% 약 250ms (감속/정지는 IP가 바로 반영)
+#endif
+#define HB_PHASE_R_TICKS    (HB_PERIOD_TICKS / 2)   // 오른쪽 바퀴는 반 주기 늦게 켜서 전류 피크 분산
+#else
+#define HANDLE_ADDR         XPAR_MYIP_HANDLE_0_BASEADDR
+#endif
+
+#define STATUS_TICK_CYC     (COUNTS_PER_SECOND / 1000 * JOINT_TICK_MS)
+
+// 현재 상태 저장
+int x1_angle = 90, y1_angle = 90, x2_angle = 90, y2_angle = 45;
+int *const joint_angle[JOINT_COUNT] = { &x1_angle, &y1_angle, &x2_angle, &y2_angle };  // PWM 채널 순서
+int left_speed = 0, right_speed = 0; // 현재 속도
+#ifdef WHEEL_ENC_HW
+#define WHEEL_TICK_CYC      (COUNTS_PER_SECOND / WHEEL_CTL_RATE_HZ)
+#define WHEEL_RAMP_CPS      24      // 제어 주기당 목표 변화: 0 -> 최고속 250ms (기존 개루프 램프와 비슷)
+int32_t wheel_target[WHEEL_ENC_COUNT];  // 스틱이 정한 목표 (카운트/초)
+int32_t wheel_ref[WHEEL_ENC_COUNT];     // 램프를 거친 제어기 목표
+wheel_pi_t wheel_pi[WHEEL_ENC_COUNT];
+static uint64_t next_tick;
+#endif
+static uint64_t next_status;
+static axis_pred_t work_pred;   // 작업 모드 축: 프레임이 잠깐 끊기면 예측으로 이어 감
+#ifdef ESTOP_HW
+static int estop_on;    // 하드웨어가 바퀴를 끊은 상태 (모터 목표는 이미 0)
+#endif
+#ifdef AXIS_MAP_HW
+static int map_on;      // 관절 변환을 IP 표가 함 (표 확인 실패면 0, 기존 펌웨어 매핑)
+#endif
+
+// 서보모터 제어
+static void move_servo(int ch, int *current_angle, int joy_val) {
+    int target = 90; // 중립위치
+
+    // 조이스틱 값에 따른 각도 계산
+    if (joy_val < NEUTRAL_MIN) {
+        target = 90 + (NEUTRAL_MIN - joy_val) * 90 / NEUTRAL_MIN;
+    } else if (joy_val > NEUTRAL_MAX) {
+        target = 90 - (joy_val - NEUTRAL_MAX) * 90 / (4095 - NEUTRAL_MAX);
+    }
+
+    if (target < 0) target = 0;
+    if (target > 180) target = 180;
+    target = joint_fb_limit(ch, target);    // 막힌 관절은 막힌 쪽으로 더 밀지 않음
+
+#ifdef PWM_OUT_HW_SLEW
+    // 램프는 PWM IP가 처리, 목표가 바뀔 때만 씀
+    if (*current_angle == target) return;
+    *current_angle = target;
+#else
+    // 부드럽게 움직이기 (급작스러운 움직임 방지)
+    if (*current_angle < target) {
+        *current_angle += 3;
+        if (*current_angle > target) *current_angle = target;
+    } else if (*current_angle > target) {
+        *current_angle -= 3;
+        if (*current_angle < target) *current_angle = target;
+    }
+#endif
+
+    // 서보모터 PWM 출력 (50Hz)
+    pwm_out_servo(ch, *current_angle);
+}
+
+// Y2 서보 제어 (0~90도만 사용)
+static void move_y2_servo(int joy_val) {
+    int target = 45; // 중립 45도
+
+    if (joy_val < NEUTRAL_MIN) {
+        target = 45 + (NEUTRAL_MIN - joy_val) * 45 / NEUTRAL_MIN;
+    } else if (joy_val > NEUTRAL_MAX) {
+        target = 45 - (joy_val - NEUTRAL_MAX) * 45 / (4095 - NEUTRAL_MAX);
+    }
+
+    if (target < 0) target = 0;
+    if (target > 90) target = 90;
+    target = joint_fb_limit(PWM_CH_Y2, target);
+
+#ifdef PWM_OUT_HW_SLEW
+    if (y2_angle == target) return;
+    y2_angle = target;
+#else
+    // 부드러운 움직임
+    if (y2_angle < target) {
+        y2_angle += 3;
+        if (y2_angle > target) y2_angle = target;
+    } else if (y2_angle > target) {
+        y2_angle -= 3;
+        if (y2_angle < target) y2_angle = target;
+    }
+#endif
+
+    pwm_out_servo(PWM_CH_Y2, y2_angle);
+}
+
+// 모터 정지
+void motion_stop(void) {
+#ifdef XPAR_MYIP_HBRIDGE_0_BASEADDR
+    volatile unsigned int *hb = (volatile unsigned int*)HBRIDGE_ADDR;
+    hb[4] = 0;
+    hb[5] = 0;
+#else
+    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
+    handle[0] = 0;
+    pwm_out_motor(PWM_CH_LEFT_WHEEL, 0);
+    pwm_out_motor(PWM_CH_RIGHT_WHEEL, 0);
+    pwm_out_commit();
+#endif
+    left_speed = 0;
+    right_speed = 0;
+#ifdef WHEEL_ENC_HW
+    for (int i = 0; i < WHEEL_ENC_COUNT; i++) {
+        wheel_target[i] = 0;
+        wheel_ref[i] = 0;
+        wheel_pi_init(&wheel_pi[i], &wheel_gains[i]);
+    }
+#endif
+}
+
+// 바퀴 구동 (점진적 가속/감속)
+static void drive_wheels(int y1_val, int y2_val) {
+    int cmd = 0;
+    int target_left = 0, target_right = 0;
+
+    // 중립구간 체크
+    if (y1_val >= NEUTRAL_MIN && y1_val <= NEUTRAL_MAX &&
+        y2_val >= NEUTRAL_MIN && y2_val <= NEUTRAL_MAX) {
+        target_left = 0;
+        target_right = 0;
+    } else {
+        // 왼쪽 바퀴
+        if (y1_val > NEUTRAL_MAX) {
+            cmd |= 0x08; // 전진
+            target_left = (y1_val - NEUTRAL_MAX) * 100 / (4095 - NEUTRAL_MAX);
+        } else if (y1_val < NEUTRAL_MIN) {
+            cmd |= 0x04; // 후진
+            target_left = (NEUTRAL_MIN - y1_val) * 100 / NEUTRAL_MIN;
+        }
+
+        // 오른쪽 바퀴
+        if (y2_val > NEUTRAL_MAX) {
+            cmd |= 0x01; // 전진
+            target_right = (y2_val - NEUTRAL_MAX) * 100 / (4095 - NEUTRAL_MAX);
+        } else if (y2_val < NEUTRAL_MIN) {
+            cmd |= 0x02; // 후진
+            target_right = (NEUTRAL_MIN - y2_val) * 100 / NEUTRAL_MIN;
+        }
+
+        if (target_left > 100) target_left = 100;
+        if (target_right > 100) target_right = 100;
+    }
+
+#ifdef WHEEL_ENC_HW
+    // 폐루프: 스틱은 목표 속도만 정하고 출력은 wheel_tick()이 제어 주기마다 씀
+    if (cmd & 0x04) target_left = -target_left;
+    if (cmd & 0x02) target_right = -target_right;
+    wheel_target[WHEEL_ENC_LEFT] = target_left * WHEEL_MAX_CPS / 100;
+    wheel_target[WHEEL_ENC_RIGHT] = target_right * WHEEL_MAX_CPS / 100;
+    left_speed = target_left;
+    right_speed = target_right;
+#elif defined(XPAR_MYIP_HBRIDGE_0_BASEADDR)
+    // 가속 제한은 IP가 PWM 주기마다 처리하므로 목표를 바로 씀
+    volatile unsigned int *hb = (volatile unsigned int*)HBRIDGE_ADDR;
+    if (cmd & 0x04) target_left = -target_left;
+    if (cmd & 0x02) target_right = -target_right;
+    hb[4] = (unsigned int)(target_left * HB_TICKS_PER_PCT);
+    hb[5] = (unsigned int)(target_right * HB_TICKS_PER_PCT);
+    left_speed = target_left;
+    right_speed = target_right;
+#else
+    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
+
+    // 점진적 가속/감속 (급작스러운 속도변화 방지)
+    if (left_speed < target_left) {
+        left_speed += 10;
+        if (left_speed > target_left) left_speed = target_left;
+    } else if (left_speed > target_left) {
+        left_speed -= 10;
+        if (left_speed < target_left) left_speed = target_left;
+    }
+
+    if (right_speed < target_right) {
+        right_speed += 10;
+        if (right_speed > target_right) right_speed = target_right;
+    } else if (right_speed > target_right) {
+        right_speed -= 10;
+        if (right_speed < target_right) right_speed = target_right;
+    }
+
+    // 모터 제어 출력
+    handle[0] = cmd;
+    pwm_out_motor(PWM_CH_LEFT_WHEEL, left_speed);
+    pwm_out_motor(PWM_CH_RIGHT_WHEEL, right_speed);
+    pwm_out_commit();
+#endif
+}
+
+#ifdef WHEEL_ENC_HW
+// 부호 있는 duty‰ 출력 (+전진)
+static void wheel_out(int32_t duty_l, int32_t duty_r) {
+#ifdef XPAR_MYIP_HBRIDGE_0_BASEADDR
+    volatile unsigned int *hb = (volatile unsigned int*)HBRIDGE_ADDR;
+    hb[4] = (unsigned int)(duty_l * HB_PERIOD_TICKS / WHEEL_DUTY_MAX);
+    hb[5] = (unsigned int)(duty_r * HB_PERIOD_TICKS / WHEEL_DUTY_MAX);
+#else
+    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
+    int cmd = 0;
+    if (duty_l > 0) cmd |= 0x08;
+    else if (duty_l < 0) { cmd |= 0x04; duty_l = -duty_l; }
+    if (duty_r > 0) cmd |= 0x01;
+    else if (duty_r < 0) { cmd |= 0x02; duty_r = -duty_r; }
+    handle[0] = cmd;
+    pwm_out_motor(PWM_CH_LEFT_WHEEL, duty_l / 10);
+    pwm_out_motor(PWM_CH_RIGHT_WHEEL, duty_r / 10);
+    pwm_out_commit();
+#endif
+}
+
+// 제어 주기마다: 엔코더 스냅샷 -> 목표 램프 -> 바퀴별 PI -> duty 출력
+static void wheel_tick(void) {
+    wheel_enc_sample_t s;
+    int32_t duty[WHEEL_ENC_COUNT];
+
+    wheel_enc_sample(&s);
+    for (int i = 0; i < WHEEL_ENC_COUNT; i++) {
+        int32_t d = wheel_target[i] - wheel_ref[i];
+        if (d > WHEEL_RAMP_CPS) d = WHEEL_RAMP_CPS;
+        if (d < -WHEEL_RAMP_CPS) d = -WHEEL_RAMP_CPS;
+        wheel_ref[i] += d;
+        duty[i] = wheel_pi_step(&wheel_pi[i], wheel_ref[i], s.speed[i]);
+    }
+    wheel_out(duty[WHEEL_ENC_LEFT], duty[WHEEL_ENC_RIGHT]);
+}
+#endif
+
+#ifdef JOINT_FB_HW
+// 관절 주기마다: 측정 각도 확인, 스톨이면 명령을 되돌려 바로 반영
+static void joint_tick(void) {
+    uint32_t changed = joint_fb_tick(joint_angle);
+#ifdef AXIS_MAP_HW
+    // 막힌 관절은 펌웨어가 넘겨받아 DUTY로 되돌림 (풀리면 다시 IP 표 출력)
+    if (map_on) axis_map_override(joint_fb_stall_mask());
+#endif
+    if (changed) {
+        for (int j = 0; j < JOINT_COUNT; j++) {
+            if (changed & (1u << j)) pwm_out_servo(j, *joint_angle[j]);
+        }
+        pwm_out_commit();
+    }
+}
+#endif
+
+static uint32_t now_ms(void) {
+    return (uint32_t)(now_cycles() / (COUNTS_PER_SECOND / 1000));
+}
+
+// 작업 모드 축 값 (받은 값 또는 예측값) -> 관절
+static void work_apply(const int32_t *ax) {
+    // 중립 체크 (불필요한 동작 방지)
+    if (ax[0] >= NEUTRAL_MIN && ax[0] <= NEUTRAL_MAX &&
+        ax[1] >= NEUTRAL_MIN && ax[1] <= NEUTRAL_MAX &&
+        ax[2] >= NEUTRAL_MIN && ax[2] <= NEUTRAL_MAX &&
+        ax[3] >= NEUTRAL_MIN && ax[3] <= NEUTRAL_MAX) {
+        return; // 중립이면 아무것도 안함
+    }
+
+    uint32_t fw = (1u << JOINT_COUNT) - 1;     // 펌웨어가 계산할 관절
+#ifdef AXIS_MAP_HW
+    if (map_on) {
+        // 표 변환은 IP가 하고 펌웨어는 넘겨받은 관절만
+        axis_map_input(ax[0], ax[1], ax[2], ax[3]);
+        fw = axis_map_overridden();
+        if (!fw) return;
+    }
+#endif
+    if (fw & (1u << PWM_CH_X1)) move_servo(PWM_CH_X1, &x1_angle, ax[0]);
+    if (fw & (1u << PWM_CH_Y1)) move_servo(PWM_CH_Y1, &y1_angle, ax[1]);
+    if (fw & (1u << PWM_CH_X2)) move_servo(PWM_CH_X2, &x2_angle, ax[2]);
+    if (fw & (1u << PWM_CH_Y2)) move_y2_servo(ax[3]);
+    pwm_out_commit();   // 관절 4개 동시 반영
+}
+
+void motion_init(void) {
+    // 모터 안전 초기화
+    pwm_out_init();
+#ifdef PWM_OUT_HW_SLEW
+    // 슬루 시작점: 출력 허용 전에 쓴 값은 바로 반영되므로 첫 명령이 0us부터 램프하지 않음
+    pwm_out_servo(PWM_CH_X1, x1_angle);
+    pwm_out_servo(PWM_CH_Y1, y1_angle);
+    pwm_out_servo(PWM_CH_X2, x2_angle);
+    pwm_out_servo(PWM_CH_Y2, y2_angle);
+#endif
+    pwm_out_start();
+#ifdef AXIS_MAP_HW
+    map_on = axis_map_init();
+#endif
+#ifdef XPAR_MYIP_HBRIDGE_0_BASEADDR
+    volatile unsigned int *hb = (volatile unsigned int*)HBRIDGE_ADDR;
+    hb[0] = 0;                      // 설정 중에는 출력 끔
+    hb[1] = HB_PERIOD_TICKS;
+    hb[2] = HB_DEADTIME_TICKS;
+    hb[3] = HB_ACCEL_TICKS;
+    hb[4] = 0;
+    hb[5] = 0;
+    hb[8] = 0;
+    hb[9] = HB_PHASE_R_TICKS;
+    hb[0] = 0x3;                    // 출력 허용 + 정지 시 브레이크
+#else
+    pwm_out_motor(PWM_CH_LEFT_WHEEL, 0);
+    pwm_out_motor(PWM_CH_RIGHT_WHEEL, 0);
+    pwm_out_commit();
+
+    volatile unsigned int *handle = (volatile unsigned int*)HANDLE_ADDR;
+    handle[0] = 0;
+#endif
+    wheel_enc_init();
+    joint_fb_init();
+    estop_init();
+    axis_pred_init(&work_pred, NEUTRAL_MIN, NEUTRAL_MAX);
+#ifdef WHEEL_ENC_HW
+    motion_stop();                  // 제어기 초기화
+    next_tick = now_cycles();
+#endif
+    next_status = now_cycles();
+}
+
+void motion_command(const motion_cmd_t *cmd) {
+#ifdef ESTOP_HW
+    if (estop_on) {
+        // 손을 뗀 중립을 받아야 해제 (비상정지 버튼 줄 자체로는 안 풀림)
+        if (cmd->stop == MOTION_STOP_NEUTRAL ||
+            (cmd->mode == 2 && cmd->y1 >= NEUTRAL_MIN && cmd->y1 <= NEUTRAL_MAX &&
+             cmd->y2 >= NEUTRAL_MIN && cmd->y2 <= NEUTRAL_MAX)) {
+            estop_clear();
+            estop_on = 0;
+        }
+        else if (cmd->mode == 2 && !cmd->stop) {
+            return;     // 주행 명령은 무시, 작업 모드(관절)는 계속
+        }
+    }
+#endif
+    if (cmd->stop) {
+        axis_pred_reset(&work_pred);
+        motion_stop();
+        return;
+    }
+
+    // 모드별 제어
+    if (cmd->mode == 1) {  // 작업 모드
+        const int32_t in[JOINT_COUNT] = { cmd->x1, cmd->y1, cmd->x2, cmd->y2 };
+        int32_t ax[JOINT_COUNT];
+        axis_pred_frame(&work_pred, in, now_ms(), ax);
+        work_apply(ax);
+    }
+    else if (cmd->mode == 2) {  // 운전 모드: 바퀴는 예측하지 않고 마지막 명령 유지
+        axis_pred_reset(&work_pred);
+        drive_wheels(cmd->y1, cmd->y2);
+    }
+}
+
+// 밀렸으면 몰아서 돌지 않고 다음 주기에 맞춤
+static int due(uint64_t now, uint64_t *next, uint64_t period) {
+    if (now < *next) return 0;
+    *next += period;
+    if (*next <= now) *next = now + period;
+    return 1;
+}
+
+int motion_poll(void) {
+    uint64_t now = now_cycles();
+#ifdef ESTOP_HW
+    // 핀은 IP가 이미 끊음: 목표/제어기를 0으로 맞춰 해제 때 튀지 않게
+    if (!estop_on && estop_tripped()) {
+        motion_stop();
+        estop_on = 1;
+    }
+#endif
+#ifdef WHEEL_ENC_HW
+    // 고정 주기 속도 제어
+    if (due(now, &next_tick, WHEEL_TICK_CYC)) wheel_tick();
+#endif
+    if (!due(now, &next_status, STATUS_TICK_CYC)) return 0;
+    int32_t ax[JOINT_COUNT];
+    if (axis_pred_tick(&work_pred, now_ms(), ax)) work_apply(ax);
+#ifdef AXIS_MAP_HW
+    if (map_on) axis_map_sync(joint_angle);     // 매핑 중인 관절은 IP 출력이 명령 각도
+#endif
+#ifdef JOINT_FB_HW
+    joint_tick();
+#endif
+    return 1;
+}
+
+void motion_status(motion_status_t *st) {
+    st->flags = 0;
+#ifdef JOINT_FB_HW
+    st->flags |= MOTION_ST_JOINT_FB;
+#endif
+#ifdef AXIS_MAP_HW
+    if (map_on) st->flags |= MOTION_ST_AXIS_MAP;
+#endif
+#ifdef ESTOP_HW
+    if (estop_on) st->flags |= MOTION_ST_ESTOP;
+#endif
+    for (int j = 0; j < JOINT_COUNT; j++) {
+        st->angle[j] = *joint_angle[j];
+        st->meas[j] = joint_state[j].meas;
+        st->raw[j] = joint_state[j].raw;
+    }
+    for (int a = 0; a < AXIS_PRED_AXES; a++) {
+        st->gap_cnt[a] = work_pred.st[a].gaps;
+        st->gap_err[a] = work_pred.st[a].max_err;
+    }
+    st->gap_ms = work_pred.max_gap_ms;
+    st->stall = joint_fb_stall_mask();
+    st->speed_l = left_speed;
+    st->speed_r = right_speed;
+}
+
+#endif
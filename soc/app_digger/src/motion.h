@@ -0,0 +1,47 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <stdint.h>
+#include "joint_fb.h"
+
+// 구동부 (서보/바퀴 PWM, H-bridge, 엔코더 속도 제어, 관절 피드백)
+// 1코어: helloworld 루프가 직접 호출 / 2코어: 모션 코어만 호출하고 명령은 메일박스로 받음
+
+#define NEUTRAL_MIN     1500    // 조이스틱 중립 구간
+#define NEUTRAL_MAX     2600    // 조이스틱 중립 구간
+
+// 조종기 한 줄을 해석한 명령 (메일박스로 그대로 보내므로 32비트 워드만)
+typedef struct {
+    int32_t mode;       // 1 작업, 2 운전 (0 = 축 값 없음)
+    int32_t x1, y1, x2, y2;
+    int32_t stop;       // MOTION_STOP_* (0 = 아님)
+} motion_cmd_t;
+
+#define MOTION_STOP_NEUTRAL 1       // 중립 (손 뗌): 하드웨어 비상정지 해제 조건
+#define MOTION_STOP_ESTOP   2       // 비상정지 버튼
+
+#define MOTION_ST_JOINT_FB  (1u << 0)   // 관절 측정값 있음 (servo_fb IP)
+#define MOTION_ST_LINK_LOST (1u << 1)   // 통신 코어가 멈춰서 모터를 세움 (2코어)
+#define MOTION_ST_AXIS_MAP  (1u << 2)   // 관절 변환을 myip_axis_map 표가 함
+#define MOTION_ST_ESTOP     (1u << 3)   // 하드웨어 비상정지 걸림 (바퀴 차단, 중립 받을 때까지)
+
+// 관절 주기마다 갱신되는 구동부 상태
+typedef struct {
+    uint32_t flags;
+    int32_t angle[JOINT_COUNT];     // 명령 각도
+    int32_t meas[JOINT_COUNT];      // 측정 각도 (-1 = 아직 없음)
+    int32_t raw[JOINT_COUNT];       // 포텐셔미터 ADC 값
+    uint32_t stall;                 // 막힌 관절 비트
+    int32_t speed_l, speed_r;       // 바퀴 목표 (%, +전진)
+    int32_t gap_cnt[JOINT_COUNT];   // 작업 모드 축별 끊김 예측 횟수 (axis_pred)
+    int32_t gap_err[JOINT_COUNT];   // 재동기 때 예측과 실제 차이 최대 (축 단위)
+    int32_t gap_ms;                 // 가장 길었던 끊김
+} motion_status_t;
+
+void motion_init(void);
+void motion_command(const motion_cmd_t *cmd);
+void motion_stop(void);
+int motion_poll(void);                          // 고정 주기 작업 실행, 관절 주기가 돌았으면 1
+void motion_status(motion_status_t *st);
+
+#endif
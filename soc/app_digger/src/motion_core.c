@@ -0,0 +1,60 @@
+#include "motion.h"
+#include "mailbox.h"
+#include "cycles.h"
+
+#ifdef DIGGER_CORE_MOTION
+
+// 2코어 구성의 모션 코어: 메일박스로 받은 명령만 실행하고 구동부 루프는 통신과 상관없이 고정 주기로 돎
+#define LINK_TIMEOUT_CYC    (COUNTS_PER_SECOND / 5)     // 통신 코어 생존 카운터가 200ms 멈추면 정지
+
+int main(void) {
+    motion_cmd_t cmd;
+    motion_status_t st;
+    uint32_t flags = 0;
+    uint32_t last_beat;
+    uint64_t now, beat_seen;
+
+    mailbox_init();
+    motion_init();
+    last_beat = mailbox_peer_beat();
+    beat_seen = now_cycles();
+
+    while (1) {
+        now = now_cycles();
+
+        // 정지는 메시지가 덮어써졌어도 정지 워드로 받음 (정지 뒤에 온 메시지는 아래에서 이어서 실행)
+        uint32_t stop = mailbox_take_stop();
+        if (stop) {
+            const motion_cmd_t stop_cmd = { .stop = (int32_t)stop };
+            flags &= ~MOTION_ST_LINK_LOST;
+            beat_seen = now;
+            motion_command(&stop_cmd);
+        }
+        if (mailbox_take(&cmd, sizeof(cmd) / 4)) {
+            flags &= ~MOTION_ST_LINK_LOST;
+            beat_seen = now;
+            motion_command(&cmd);
+        }
+
+        // 통신 코어가 멈추면 마지막 명령으로 계속 달리지 않게 세움
+        uint32_t beat = mailbox_peer_beat();
+        if (beat != last_beat) {
+            last_beat = beat;
+            beat_seen = now;
+        }
+        else if (!(flags & MOTION_ST_LINK_LOST) && now - beat_seen > LINK_TIMEOUT_CYC) {
+            motion_stop();
+            flags |= MOTION_ST_LINK_LOST;
+        }
+
+        // 관절 주기마다 상태를 통신 코어로 (통신 코어는 이것으로 모션 코어 생존 확인)
+        if (motion_poll()) {
+            motion_status(&st);
+            st.flags |= flags;
+            mailbox_post(&st, sizeof(st) / 4);
+        }
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "playout.h"
+#include <string.h>
+
+void playout_init(playout_t *p, uint32_t target_ms) {
+    memset(p, 0, sizeof(*p));
+    p->target_us = target_ms * 1000;
+    p->jitter_us = p->target_us;    // 처음에는 흔들림을 모르므로 상한부터
+    p->delay_us = p->target_us;
+}
+
+void playout_stats(const playout_t *p, playout_stats_t *s) {
+    s->delay_us = p->delay_us;
+    s->jitter_us = p->jitter_us;
+    s->max_jitter_us = p->max_jitter_us;
+    s->frames = p->frames;
+    s->late = p->late;
+    s->dropped = p->dropped;
+}
+
+void playout_flush(playout_t *p) {
+    p->count = 0;
+}
+
+void playout_put(playout_t *p, uint32_t tx_ms, uint32_t arrive_us, const void *msg, int words) {
+    uint32_t sample = arrive_us - tx_ms * 1000;
+
+    // 바닥: 가장 빨리 온 프레임 (시계가 벌어지는 쪽은 조금씩 올려서 따라감)
+    if (!p->have || (int32_t)(sample - p->floor_us) < 0) {
+        p->floor_us = sample;
+        p->have = 1;
+    }
+    else {
+        p->floor_us += ((int32_t)(sample - p->floor_us) < PLAYOUT_DRIFT_US) ? sample - p->floor_us : PLAYOUT_DRIFT_US;
+    }
+
+    // 흔들림: 최근 최대 (프레임마다 1/64 씩 줄어듦, 50Hz 면 약 1.3초)
+    uint32_t jit = sample - p->floor_us;
+    p->jitter_us -= p->jitter_us >> 6;
+    if (jit > p->jitter_us) p->jitter_us = jit;
+    if (jit > p->max_jitter_us) p->max_jitter_us = jit;
+
+    uint32_t want = p->jitter_us + PLAYOUT_GUARD_US;
+    if (want > p->target_us) want = p->target_us;
+    if (want > p->delay_us + PLAYOUT_SLEW_US) p->delay_us += PLAYOUT_SLEW_US;
+    else if (want + PLAYOUT_SLEW_US < p->delay_us) p->delay_us -= PLAYOUT_SLEW_US;
+    else p->delay_us = want;
+
+    uint32_t at = tx_ms * 1000 + p->floor_us + p->delay_us;
+    if ((int32_t)(at - arrive_us) < 0) {
+        at = arrive_us;
+        p->late++;
+    }
+    if (p->count && (int32_t)(at - p->last_at) < 0) at = p->last_at;  // 순서는 바꾸지 않음
+    p->last_at = at;
+    p->frames++;
+
+    if (p->count == PLAYOUT_SLOTS) {
+        p->head = (p->head + 1) % PLAYOUT_SLOTS;
+        p->count--;
+        p->dropped++;
+    }
+    playout_slot_t *s = &p->slot[(p->head + p->count) % PLAYOUT_SLOTS];
+    s->at_us = at;
+    memcpy(s->msg, msg, words * 4);
+    p->count++;
+}
+
+int playout_take(playout_t *p, uint32_t now_us, void *msg, int words) {
+    if (!p->count) return 0;
+    playout_slot_t *s = &p->slot[p->head];
+    if ((int32_t)(now_us - s->at_us) < 0) return 0;
+    memcpy(msg, s->msg, words * 4);
+    p->head = (p->head + 1) % PLAYOUT_SLOTS;
+    p->count--;
+    return 1;
+}
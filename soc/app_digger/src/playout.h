@@ -0,0 +1,57 @@
+#ifndef PLAYOUT_H
+#define PLAYOUT_H
+
+#include <stdint.h>
+
+// 조종기 명령 재생 버퍼 (하드웨어 의존 없음: sim/ 에서 호스트로도 빌드)
+// 프레임의 송신 시각을 수신부 시계로 옮겨 (도착 - 송신 의 최소값 = 지연 바닥 + 시계 차이)
+// 송신 간격 그대로 재생. 재생 지연은 최근 흔들림에 맞춰 줄고 늘지만 PLAYOUT_TARGET_MS 를 넘지 않음
+#ifndef PLAYOUT_TARGET_MS
+#define PLAYOUT_TARGET_MS   25      // 재생 지연 상한 (0 = 끔, 받는 즉시 적용)
+#endif
+#define PLAYOUT_SLOTS       8
+#define PLAYOUT_MSG_WORDS   8
+#define PLAYOUT_GUARD_US    2000    // 흔들림 최대값 위 여유
+#define PLAYOUT_DRIFT_US    4       // 프레임마다 바닥을 이만큼 올려 봄 (시계 오차 100ppm x 20ms 의 두 배)
+#define PLAYOUT_SLEW_US     500     // 프레임마다 재생 지연 변화 한도 (간격이 갑자기 바뀌지 않게)
+
+typedef struct {
+    uint32_t at_us;                 // 재생 시각 (수신부 시계)
+    uint32_t msg[PLAYOUT_MSG_WORDS];
+} playout_slot_t;
+
+typedef struct {
+    uint32_t target_us;
+    uint32_t floor_us;              // 도착 - 송신 최소 (u32 나머지 연산)
+    uint32_t jitter_us;             // 바닥 위 도착 흔들림 (최근 최대, 천천히 줄어듦)
+    uint32_t delay_us;              // 현재 재생 지연 (바닥 기준)
+    uint32_t last_at;
+    uint8_t have;
+    uint8_t head, count;
+    playout_slot_t slot[PLAYOUT_SLOTS];
+    // 통계
+    uint32_t frames;
+    uint32_t late;                  // 재생 시각이 이미 지나서 받자마자 적용
+    uint32_t dropped;               // 버퍼가 차서 버린 명령
+    uint32_t max_jitter_us;
+} playout_t;
+
+// 보고용 통계 사본 (다른 태스크에서 읽을 때는 버퍼를 가진 쪽에서 떠서 넘김)
+typedef struct {
+    uint32_t delay_us;
+    uint32_t jitter_us;
+    uint32_t max_jitter_us;
+    uint32_t frames;
+    uint32_t late;
+    uint32_t dropped;
+} playout_stats_t;
+
+void playout_init(playout_t *p, uint32_t target_ms);
+void playout_stats(const playout_t *p, playout_stats_t *s);
+void playout_flush(playout_t *p);   // 정지/중립: 밀린 명령 버림 (시계 추정은 유지)
+// 송신 시각이 있는 명령 넣기 (arrive_us = 받은 시각, 수신부 시계)
+void playout_put(playout_t *p, uint32_t tx_ms, uint32_t arrive_us, const void *msg, int words);
+// 재생 시각이 된 명령이 있으면 msg 에 복사하고 1
+int playout_take(playout_t *p, uint32_t now_us, void *msg, int words);
+
+#endif
@@ -0,0 +1,162 @@
+#include "pwm_out.h"
+#include "xil_io.h"
+
+#ifdef PWM_OUT_HW
+
+#define SYS_CLK_FREQ    100000000
+#define SERVO_MIN_US    500
+#define SERVO_MAX_US    2500
+
+// 모든 값은 100MHz 클럭 단위 (10ns), 루프에서 나눗셈 없음
+#define TICKS_PER_US        (SYS_CLK_FREQ / 1000000)
+#define SERVO_PERIOD_TICKS  (SYS_CLK_FREQ / 50)         // 20ms
+#define MOTOR_PERIOD_TICKS  (SYS_CLK_FREQ / 20000)      // 50us = 20kHz (가청 대역 밖, 5000단계 ≈ 12비트)
+#define SERVO_MIN_TICKS     (SERVO_MIN_US * TICKS_PER_US)
+#define SERVO_TICKS_PER_DEG ((SERVO_MAX_US - SERVO_MIN_US) * TICKS_PER_US / 180)
+#define MOTOR_TICKS_PER_PCT (MOTOR_PERIOD_TICKS / 100)
+
+// 채널별 myip_pwm 구성에서 클럭 단위 모드를 쓸지 (기존 비트스트림의 myip_pwm 은 이 모드가 없음)
+#ifndef PWM_TICK_MODE
+#define PWM_TICK_MODE       0
+#endif
+
+#if defined(XPAR_MYIP_PWM_MULTI_0_BASEADDR) || PWM_TICK_MODE
+static uint32_t servo_ticks(int angle) {
+    return SERVO_MIN_TICKS + SERVO_TICKS_PER_DEG * angle;
+}
+#endif
+
+#ifdef XPAR_MYIP_PWM_MULTI_0_BASEADDR
+// 8채널 PWM IP 하나: 서보는 타임베이스0 (20ms), 바퀴는 타임베이스1 (50us), 둘 다 분주 없음
+// 동기 모드라서 duty는 pwm_out_commit() 후 주기 경계에서만 바뀜 (관절 4개가 같은 펄스부터 움직임)
+#define PWM_MULTI_ADDR      XPAR_MYIP_PWM_MULTI_0_BASEADDR
+#define PWM_CTRL            0x00
+#define PWM_CH_EN           0x04
+#define PWM_TB_SEL          0x08
+#define PWM_COMMIT          0x0C
+#define PWM_TB0_PRESCALE    0x10
+#define PWM_TB0_PERIOD      0x14
+#define PWM_TB1_PRESCALE    0x18
+#define PWM_TB1_PERIOD      0x1C
+#define PWM_DUTY(ch)        (0x20 + (ch) * 4)
+#define PWM_RATE(ch)        (0x80 + (ch) * 4)
+#define PWM_STATUS          0xE0
+#define PWM_ALIGN           0xE4
+#define PWM_PHASE(ch)       (0x100 + (ch) * 4)
+
+void pwm_out_init(void) {
+    Xil_Out32(PWM_MULTI_ADDR + PWM_CTRL, 0);
+    Xil_Out32(PWM_MULTI_ADDR + PWM_TB0_PRESCALE, 0);
+    Xil_Out32(PWM_MULTI_ADDR + PWM_TB0_PERIOD, SERVO_PERIOD_TICKS);
+    Xil_Out32(PWM_MULTI_ADDR + PWM_TB1_PRESCALE, 0);
+    Xil_Out32(PWM_MULTI_ADDR + PWM_TB1_PERIOD, MOTOR_PERIOD_TICKS);
+    Xil_Out32(PWM_MULTI_ADDR + PWM_TB_SEL, (1 << PWM_CH_LEFT_WHEEL) | (1 << PWM_CH_RIGHT_WHEEL));
+    
+    // 오른쪽 바퀴는 반 주기 늦게 켬: 50% 이하에서는 두 L298N 채널이 겹치지 않아 배터리 전류 피크가 반으로
+    Xil_Out32(PWM_MULTI_ADDR + PWM_PHASE(PWM_CH_RIGHT_WHEEL), MOTOR_PERIOD_TICKS / 2);
+    
+    // 서보는 첫 명령 전까지 펄스 없음 (기존 동작과 같음)
+    for (int ch = 0; ch < PWM_CH_COUNT; ch++) Xil_Out32(PWM_MULTI_ADDR + PWM_DUTY(ch), 0);
+    
+    // 서보 채널 슬루 제한, 바퀴는 펌웨어에서 가감속
+    for (int ch = PWM_CH_X1; ch <= PWM_CH_Y2; ch++) {
+        Xil_Out32(PWM_MULTI_ADDR + PWM_RATE(ch), SERVO_TICKS_PER_DEG * SERVO_SLEW_DEG);
+    }
+    
+    Xil_Out32(PWM_MULTI_ADDR + PWM_CH_EN, (1 << PWM_CH_COUNT) - 1);
+}
+
+void pwm_out_start(void) {
+    Xil_Out32(PWM_MULTI_ADDR + PWM_CTRL, 0x3);   // 출력 허용 + 동기 모드
+}
+
+void pwm_out_servo(int ch, int angle) {
+    Xil_Out32(PWM_MULTI_ADDR + PWM_DUTY(ch), servo_ticks(angle));
+}
+
+void pwm_out_motor(int ch, int speed) {
+    if (speed > 100) speed = 100;
+    if (speed < 0) speed = 0;
+    Xil_Out32(PWM_MULTI_ADDR + PWM_DUTY(ch), MOTOR_TICKS_PER_PCT * speed);
+}
+
+void pwm_out_commit(void) {
+    Xil_Out32(PWM_MULTI_ADDR + PWM_COMMIT, 1);
+}
+
+#else
+// 채널마다 myip_pwm 하나, IP마다 카운터가 따로 돌아서 위상 지정은 없음
+// PWM_TICK_MODE=1: 클럭 단위 모드 (0x0 high 클럭 수, 0x4 주기 클럭 수, 0xC[0] 모드), 다시 패키징한 myip_pwm 필요
+// 기본값 0: 기존 비트스트림의 duty/temp/duty_step 방식 (0x0 duty, 0x4 temp, 0x8 duty_step)
+
+static const uint32_t pwm_addr[PWM_CH_COUNT] = {
+    XPAR_MYIP_PWM_X1_BASEADDR,
+    XPAR_MYIP_PWM_Y1_BASEADDR,
+    XPAR_MYIP_PWM_X2_BASEADDR,
+    XPAR_MYIP_PWM_Y2_BASEADDR,
+    XPAR_MYIP_PWM_LEFT_WHEEL_BASEADDR,
+    XPAR_MYIP_PWM_RIGHT_WHEEL_BASEADDR,
+    XPAR_MYIP_PWM_BLADE_BASEADDR,
+};
+
+#if PWM_TICK_MODE
+#define PWM_HIGH_TICKS      0x0
+#define PWM_PERIOD_TICKS    0x4
+#define PWM_MODE            0xC
+
+static void pwm_setup(int ch, uint32_t period_ticks) {
+    Xil_Out32(pwm_addr[ch] + PWM_HIGH_TICKS, 0);
+    Xil_Out32(pwm_addr[ch] + PWM_PERIOD_TICKS, period_ticks);
+    Xil_Out32(pwm_addr[ch] + PWM_MODE, 1);
+}
+
+void pwm_out_init(void) {
+    for (int ch = PWM_CH_X1; ch <= PWM_CH_Y2; ch++) pwm_setup(ch, SERVO_PERIOD_TICKS);
+    pwm_setup(PWM_CH_LEFT_WHEEL, MOTOR_PERIOD_TICKS);
+    pwm_setup(PWM_CH_RIGHT_WHEEL, MOTOR_PERIOD_TICKS);
+}
+
+void pwm_out_servo(int ch, int angle) {
+    Xil_Out32(pwm_addr[ch] + PWM_HIGH_TICKS, servo_ticks(angle));
+}
+
+void pwm_out_motor(int ch, int speed) {
+    if (speed > 100) speed = 100;
+    if (speed < 0) speed = 0;
+    Xil_Out32(pwm_addr[ch] + PWM_HIGH_TICKS, MOTOR_TICKS_PER_PCT * speed);
+}
+#else
+static void pwm_write(int ch, uint32_t duty, uint32_t freq) {
+    uint32_t addr = pwm_addr[ch];
+    
+    Xil_Out32(addr, duty);
+    Xil_Out32(addr + 0x4, SYS_CLK_FREQ / freq / 4095 / 2);
+    Xil_Out32(addr + 0x8, 4095);
+}
+
+void pwm_out_init(void) {
+}
+
+void pwm_out_servo(int ch, int angle) {
+    uint32_t duty_min = 4095 * 5 / 200;  
+    uint32_t duty_max = 4095 * 25 / 200; 
+    pwm_write(ch, duty_min + ((duty_max - duty_min) * angle) / 180, 50);
+}
+
+// 이 방식은 temp 가 0이 되지 않도록 1kHz 그대로 (20kHz 는 분해능이 안 나옴)
+void pwm_out_motor(int ch, int speed) {
+    if (speed > 100) speed = 100;
+    if (speed < 0) speed = 0;
+    pwm_write(ch, (4095 * speed) / 100, 1000);
+}
+#endif
+
+void pwm_out_start(void) {
+}
+
+// 채널마다 IP가 따로라 일괄 반영은 없음 (각 IP가 자기 주기 경계에서 반영)
+void pwm_out_commit(void) {
+}
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef PWM_OUT_H
+#define PWM_OUT_H
+
+#include <stdint.h>
+#include "xparameters.h"
+
+// 서보 이동 속도: 20ms 주기마다 최대 3도 (기존 소프트웨어 램프와 같은 속도)
+#define SERVO_SLEW_DEG  3
+
+#if defined(XPAR_MYIP_PWM_MULTI_0_BASEADDR) || defined(XPAR_MYIP_PWM_X1_BASEADDR)
+#define PWM_OUT_HW          // 이 코어가 PWM을 가짐 (2코어 구성에서는 모션 코어만)
+#endif
+
+#ifdef XPAR_MYIP_PWM_MULTI_0_BASEADDR
+#define PWM_OUT_HW_SLEW     // IP가 목표각까지 스스로 램프, 펌웨어는 목표만 씀
+#endif
+
+// 굴삭기 PWM 채널 (myip_pwm_multi 채널 번호와 같음)
+enum {
+    PWM_CH_X1 = 0,
+    PWM_CH_Y1,
+    PWM_CH_X2,
+    PWM_CH_Y2,
+    PWM_CH_LEFT_WHEEL,
+    PWM_CH_RIGHT_WHEEL,
+    PWM_CH_BLADE,
+    PWM_CH_COUNT
+};
+
+void pwm_out_init(void);                // 출력은 꺼진 상태로 설정만 (이때 쓴 duty는 바로 반영)
+void pwm_out_start(void);
+void pwm_out_servo(int ch, int angle);  // 0~180도, 50Hz 0.5~2.5ms
+void pwm_out_motor(int ch, int speed);  // 0~100%
+void pwm_out_commit(void);              // 위에서 쓴 값들을 다음 주기 경계에서 한꺼번에 반영
+
+#endif
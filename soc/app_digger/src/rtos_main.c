@@ -0,0 +1,276 @@
+#include "digger_rtos.h"
+
+#ifdef DIGGER_RTOS
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "xuartlite.h"
+#include "xuartlite_l.h"
+#include "xinterrupt_wrap.h"
+#include "xparameters.h"
+#include "xil_io.h"
+#include "cycles.h"
+#include "link_rx.h"
+#include <stdio.h>
+#include <string.h>
+
+// 슈퍼루프 한 바퀴를 태스크 셋으로 나눔 (높은 것부터)
+//   act: 1ms 틱마다 명령 큐 → 재생 버퍼 → motion_poll (구동 출력은 이 태스크만 만짐)
+//   rx : UART 인터럽트가 채운 스트림 버퍼 → 줄/제어 바이트 해석, 이진 프레임 IP 확인
+//   dbg: 상태 보고, USB 디버그 출력 (바쁜 대기 출력은 여기서만), 5초마다 태스크 통계
+// configTICK_RATE_HZ 는 캐스트가 붙어 있을 수 있어 전처리기 비교 대신
+_Static_assert(pdMS_TO_TICKS(1) >= 1, "act task needs a 1 ms tick (FreeRTOS domain tick_rate 1000)");   // 구동 태스크는 1ms 틱
+
+#define ACT_PRIO        (configMAX_PRIORITIES - 1)
+#define RX_PRIO         (configMAX_PRIORITIES - 2)
+#define DBG_PRIO        (tskIDLE_PRIORITY + 1)
+#define ACT_STACK       512     // 워드
+#define RX_STACK        512
+#define DBG_STACK       768     // report_status 의 snprintf
+#define ACT_PERIOD      1       // 틱
+#define CMD_QUEUE_LEN   16
+#define RX_SB_SIZE      256     // 38400bps 로 약 65ms 분량
+#define DBG_SB_SIZE     1024
+#define RX_WAIT_MS      5       // 이진 프레임은 IP가 받으므로 바이트가 없어도 이만큼마다 확인
+#define STATS_MS        5000
+
+#define HC05_BASEADDR   XPAR_XUARTLITE_0_BASEADDR
+#define CYC_PER_US      (COUNTS_PER_SECOND / 1000000)
+
+typedef struct {
+    motion_cmd_t cmd;
+    uint8_t timed;              // 송신 시각 있음: 재생 버퍼로
+    uint32_t tx_ms;
+    uint32_t arrive_us;
+} act_msg_t;
+
+// act → dbg 상태 보고 (재생 버퍼 통계는 act 가 떠서 넘김: dbg 가 버퍼를 직접 읽지 않게)
+typedef struct {
+    motion_status_t st;
+    playout_stats_t play;
+} act_report_t;
+
+// 태스크별 실행 시간 (깨어나서 다시 막힐 때까지, 높은 우선순위가 끼어든 시간은 뺌)
+typedef struct {
+    const char *name;
+    TaskHandle_t handle;
+    volatile uint32_t busy_us;  // 통계 구간 누적
+    uint32_t max_us;            // 한 번 실행 최대
+    uint32_t runs;
+    uint64_t start;
+    uint32_t hi_start;          // 시작할 때 높은 우선순위 태스크 누적
+} task_stat_t;
+
+enum { T_ACT, T_RX, T_DBG, T_COUNT };
+static task_stat_t stats[T_COUNT] = { { .name = "act" }, { .name = "rx" }, { .name = "dbg" } };
+
+extern XUartLite Uart_HC05;
+static QueueHandle_t act_q;
+static QueueHandle_t status_q;
+static StreamBufferHandle_t rx_sb;
+static StreamBufferHandle_t dbg_sb;
+static uint32_t act_q_full;
+static uint32_t rx_overflow;
+static uint32_t dbg_dropped;
+
+static uint32_t hi_busy(int id) {
+    uint32_t sum = 0;
+    for (int i = 0; i < id; i++) sum += stats[i].busy_us;
+    return sum;
+}
+
+static void stat_begin(int id) {
+    task_stat_t *t = &stats[id];
+    t->start = now_cycles();
+    t->hi_start = hi_busy(id);
+}
+
+static void stat_end(int id) {
+    task_stat_t *t = &stats[id];
+    uint64_t end = now_cycles();
+    uint32_t run = (uint32_t)((end - t->start) / CYC_PER_US) - (hi_busy(id) - t->hi_start);
+    t->busy_us += run;
+    if (run > t->max_us) t->max_us = run;
+    t->runs++;
+}
+
+// 해석한 명령은 큐로만 넘김 (재생 버퍼와 구동부는 act 태스크 것)
+void rtos_motion_post(const motion_cmd_t *cmd, int timed, uint32_t tx_ms, uint32_t arrive_us) {
+    act_msg_t m = { *cmd, (uint8_t)timed, tx_ms, arrive_us };
+    // act 가 1ms 마다 비우므로 찼으면 잠깐 기다림 (정지 명령을 버리지 않게)
+    if (xQueueSend(act_q, &m, pdMS_TO_TICKS(5)) != pdPASS) act_q_full++;
+}
+
+// 여러 태스크가 쓰므로 스트림 버퍼 쓰기는 스케줄러 멈춘 채로, 찼으면 버림 (구동 태스크를 막지 않음)
+void rtos_debug_write(const char *str) {
+    size_t len = strlen(str);
+    vTaskSuspendAll();
+    if (xStreamBufferSpacesAvailable(dbg_sb) >= len) xStreamBufferSend(dbg_sb, str, len, 0);
+    else dbg_dropped++;
+    xTaskResumeAll();
+}
+
+static void act_task(void *arg) {
+    (void)arg;
+    TickType_t wake = xTaskGetTickCount();
+    act_msg_t m;
+    motion_cmd_t play_cmd;
+    act_report_t rep;
+
+    while (1) {
+        vTaskDelayUntil(&wake, ACT_PERIOD);
+        stat_begin(T_ACT);
+        while (xQueueReceive(act_q, &m, 0) == pdPASS) {
+            if (m.timed) {
+                playout_put(&link_play, m.tx_ms, m.arrive_us, &m.cmd, sizeof(m.cmd) / 4);
+                continue;
+            }
+            if (m.cmd.stop) playout_flush(&link_play);  // 밀린 축 명령이 정지 뒤에 나가지 않게
+            motion_command(&m.cmd);
+        }
+        while (playout_take(&link_play, now_us(), &play_cmd, sizeof(play_cmd) / 4)) {
+            motion_command(&play_cmd);
+        }
+        if (motion_poll()) {
+            motion_status(&rep.st);
+            playout_stats(&link_play, &rep.play);
+            xQueueOverwrite(status_q, &rep);    // 보고가 밀리면 최신 것만
+        }
+        stat_end(T_ACT);
+    }
+}
+
+// HC-05 RX FIFO 를 비워 rx 태스크로 (FIFO 16바이트, 38400bps 면 4ms 안에 비워야 함)
+// 읽는 동안 들어온 바이트까지 VALID 가 꺼질 때까지 비움: 남기면 다음 인터럽트가 안 와서 수신이 멈춤
+static void hc05_isr(void *arg) {
+    (void)arg;
+    uint8_t buf[16];
+    size_t n = 0;
+    BaseType_t woken = pdFALSE;
+
+    while (Xil_In32(HC05_BASEADDR + XUL_STATUS_REG_OFFSET) & XUL_SR_RX_FIFO_VALID_DATA) {
+        buf[n++] = (uint8_t)Xil_In32(HC05_BASEADDR + XUL_RX_FIFO_OFFSET);
+        if (n == sizeof(buf)) {
+            if (xStreamBufferSendFromISR(rx_sb, buf, n, &woken) != n) rx_overflow++;
+            n = 0;
+        }
+    }
+    if (n && xStreamBufferSendFromISR(rx_sb, buf, n, &woken) != n) rx_overflow++;
+    portYIELD_FROM_ISR(woken);
+}
+
+static void rx_task(void *arg) {
+    (void)arg;
+    uint8_t buf[32];
+
+    while (1) {
+        size_t n = xStreamBufferReceive(rx_sb, buf, sizeof(buf), pdMS_TO_TICKS(RX_WAIT_MS));
+        stat_begin(T_RX);
+        for (size_t i = 0; i < n; i++) {
+            rx_byte(buf[i]);
+        }
+        link_poll_frame();
+        rx_poll_timeout();
+        stat_end(T_RX);
+    }
+}
+
+static void report_tasks(uint32_t window_us) {
+    char msg[96];
+    uint32_t busy = 0;
+
+    for (int i = 0; i < T_COUNT; i++) {
+        task_stat_t *t = &stats[i];
+        uint32_t b = t->busy_us;
+        busy += b;
+        snprintf(msg, sizeof(msg), "TASK %s cpu=%u.%u%% runs=%u max=%uus stack_free=%uw\r\n",
+            t->name, (unsigned)(b * 100ull / window_us), (unsigned)(b * 1000ull / window_us % 10),
+            (unsigned)t->runs, (unsigned)t->max_us, (unsigned)uxTaskGetStackHighWaterMark(t->handle));
+        usb_write(msg);
+    }
+    uint32_t idle = busy < window_us ? window_us - busy : 0;
+    snprintf(msg, sizeof(msg), "TASK idle=%u%% heap_free=%u q_full=%u rx_ovf=%u dbg_drop=%u\r\n",
+        (unsigned)(idle * 100ull / window_us), (unsigned)xPortGetFreeHeapSize(),
+        (unsigned)act_q_full, (unsigned)rx_overflow, (unsigned)dbg_dropped);
+    usb_write(msg);
+
+    // 구간 초기화: 도중에 act/rx 가 끼어들면 hi_start 와 누적이 어긋나므로 스케줄러 멈추고
+    vTaskSuspendAll();
+    for (int i = 0; i < T_COUNT; i++) {
+        stats[i].busy_us = 0;
+        stats[i].max_us = 0;
+        stats[i].runs = 0;
+    }
+    xTaskResumeAll();
+}
+
+static void dbg_task(void *arg) {
+    (void)arg;
+    char buf[64];
+    act_report_t rep;
+    uint64_t now, window_start = now_cycles();
+
+    while (1) {
+        int have = xQueueReceive(status_q, &rep, pdMS_TO_TICKS(10)) == pdPASS;
+        stat_begin(T_DBG);
+        if (have) report_status(&rep.st, &rep.play);
+        size_t n;
+        while ((n = xStreamBufferReceive(dbg_sb, buf, sizeof(buf) - 1, 0)) > 0) {
+            buf[n] = '\0';
+            usb_write(buf);
+        }
+        stat_end(T_DBG);
+
+        now = now_cycles();
+        uint32_t window_us = (uint32_t)((now - window_start) / CYC_PER_US);
+        if (window_us >= STATS_MS * 1000u) {
+            report_tasks(window_us);
+            window_start = now;
+        }
+    }
+}
+
+static void hc05_irq_init(void) {
+    XUartLite_Config *cfg = XUartLite_LookupConfig(HC05_BASEADDR);
+    XUartLite_ResetFifos(&Uart_HC05);
+    XSetupInterruptSystem(NULL, (void *)hc05_isr, cfg->IntrId, cfg->IntrParent, XINTERRUPT_DEFAULT_PRIORITY);
+    XUartLite_EnableInterrupt(&Uart_HC05);
+}
+
+int main(void) {
+    if (XUartLite_Initialize(&Uart_HC05, HC05_BASEADDR) != XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+    usb_write("System Start! (FreeRTOS)\r\n");
+
+    motion_init();
+#ifdef LINK_RX_HW
+    link_rx_init();
+#endif
+    playout_init(&link_play, PLAYOUT_TARGET_MS);
+
+    act_q = xQueueCreate(CMD_QUEUE_LEN, sizeof(act_msg_t));
+    status_q = xQueueCreate(1, sizeof(act_report_t));
+    rx_sb = xStreamBufferCreate(RX_SB_SIZE, 1);
+    dbg_sb = xStreamBufferCreate(DBG_SB_SIZE, 1);
+    if (!act_q || !status_q || !rx_sb || !dbg_sb) {
+        usb_write("RTOS: OUT OF HEAP\r\n");
+        return XST_FAILURE;
+    }
+
+    xTaskCreate(act_task, "act", ACT_STACK, NULL, ACT_PRIO, &stats[T_ACT].handle);
+    xTaskCreate(rx_task, "rx", RX_STACK, NULL, RX_PRIO, &stats[T_RX].handle);
+    xTaskCreate(dbg_task, "dbg", DBG_STACK, NULL, DBG_PRIO, &stats[T_DBG].handle);
+    hc05_irq_init();
+
+    usb_write("System Ready!\r\n");
+    vTaskStartScheduler();
+
+    usb_write("RTOS: SCHEDULER EXITED\r\n");
+    while (1);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "wheel_ctl.h"
+
+// 왼쪽/오른쪽 모터는 같은 모델이라도 기어 마찰이 달라 따로 맞춤
+const wheel_gain_t wheel_gains[] = {
+    { .kff = 9100, .ff_static = 55, .kp = 36000, .ki = 700 },   // 왼쪽
+    { .kff = 9900, .ff_static = 70, .kp = 38000, .ki = 700 },   // 오른쪽
+};
+
+static int32_t clamp_duty(int32_t v)
+{
+    if (v > WHEEL_DUTY_MAX) return WHEEL_DUTY_MAX;
+    if (v < -WHEEL_DUTY_MAX) return -WHEEL_DUTY_MAX;
+    return v;
+}
+
+// 산술 시프트 (음수는 -inf 방향 내림)
+static int32_t q16(int64_t v)
+{
+    return (int32_t)(v >> 16);
+}
+
+void wheel_pi_init(wheel_pi_t *c, const wheel_gain_t *g)
+{
+    c->g = g;
+    c->integ = 0;
+    c->duty = 0;
+    c->saturated = 0;
+}
+
+// 한 주기 실행: duty = 피드포워드 + P + I
+// anti-windup: 출력이 한계에 걸린 상태에서 같은 방향으로 더 미는 오차는 적분하지 않음
+int32_t wheel_pi_step(wheel_pi_t *c, int32_t target_cps, int32_t meas_cps)
+{
+    const wheel_gain_t *g = c->g;
+
+    if (target_cps == 0 && meas_cps > -WHEEL_STOP_CPS && meas_cps < WHEEL_STOP_CPS) {
+        c->integ = 0;
+        c->duty = 0;
+        c->saturated = 0;
+        return 0;
+    }
+
+    int32_t err = target_cps - meas_cps;
+    int32_t ff = q16((int64_t)g->kff * target_cps);
+    if (target_cps > 0) ff += g->ff_static;
+    else if (target_cps < 0) ff -= g->ff_static;
+
+    int32_t p = q16((int64_t)g->kp * err);
+    int32_t integ = c->integ;
+    int windup = c->saturated && ((err > 0) == (c->duty > 0));
+    if (!windup) {
+        integ += g->ki * err;
+        // 적분 혼자서도 한계를 넘지 않게
+        if (integ > (WHEEL_DUTY_MAX << 16)) integ = WHEEL_DUTY_MAX << 16;
+        if (integ < -(WHEEL_DUTY_MAX << 16)) integ = -(WHEEL_DUTY_MAX << 16);
+    }
+
+    int32_t raw = ff + p + (integ >> 16);
+    int32_t duty = clamp_duty(raw);
+
+    c->integ = integ;
+    c->duty = duty;
+    c->saturated = (duty != raw);
+    return duty;
+}
@@ -0,0 +1,33 @@
+#ifndef WHEEL_CTL_H
+#define WHEEL_CTL_H
+
+#include <stdint.h>
+
+// 바퀴 속도 PI 제어기 (고정소수점, 하드웨어 의존 없음: sim/ 에서 호스트로도 빌드)
+// 속도 단위는 엔코더 카운트/초, 출력은 부호 있는 duty ‰ (+전진)
+#define WHEEL_CTL_RATE_HZ   1000        // 제어 주기 1ms
+#define WHEEL_DUTY_MAX      1000        // 100.0%
+#define WHEEL_MAX_CPS       6000        // 스틱 끝 = 목표 6000 카운트/초 (무부하 최고속의 약 80%)
+#define WHEEL_STOP_CPS      50          // 목표 0이고 이보다 느리면 적분을 비우고 출력 0 (브레이크가 잡음)
+
+// 바퀴별 이득 (Q16). sim/run_sim.sh 스텝 응답으로 맞춘 값
+typedef struct {
+    int32_t kff;        // 피드포워드: duty‰ / (카운트/초)
+    int32_t ff_static;  // 정지마찰 보상 duty‰ (움직이기 시작하는 최소 duty)
+    int32_t kp;         // 비례: duty‰ / (카운트/초)
+    int32_t ki;         // 적분: 제어 주기당 duty‰ / (카운트/초)
+} wheel_gain_t;
+
+typedef struct {
+    const wheel_gain_t *g;
+    int32_t integ;      // 적분 누적 (Q16 duty‰)
+    int32_t duty;       // 마지막 출력
+    uint8_t saturated;  // 마지막 출력이 한계에 걸렸는지
+} wheel_pi_t;
+
+extern const wheel_gain_t wheel_gains[];    // 채널 순서는 WHEEL_ENC_LEFT/RIGHT
+
+void wheel_pi_init(wheel_pi_t *c, const wheel_gain_t *g);
+int32_t wheel_pi_step(wheel_pi_t *c, int32_t target_cps, int32_t meas_cps);
+
+#endif
@@ -0,0 +1,58 @@
+#include "wheel_enc.h"
+#include "xil_io.h"
+
+#ifdef WHEEL_ENC_HW
+
+#define SYS_CLK_FREQ    100000000
+#define ENC_ADDR        XPAR_MYIP_ENCODER_0_BASEADDR
+
+// myip_encoder 레지스터 (ip_repo/myip_encoder_1_0/regmap.json)
+#define ENC_CTRL        0x00
+#define ENC_LATCH       0x04
+#define ENC_TIMEOUT     0x08
+#define ENC_STAMP       0x0C
+#define ENC_CLEAR       0x10
+#define ENC_POS(ch)     (0x20 + (ch) * 4)
+#define ENC_PERIOD(ch)  (0x30 + (ch) * 4)
+
+#define ENC_FILTER_TICKS    20                  // 200ns 미만 글리치 무시
+#define ENC_TIMEOUT_TICKS   (SYS_CLK_FREQ / 10) // 100ms 동안 카운트 없으면 정지
+#define ENC_INVERT_RIGHT    (1 << (16 + WHEEL_ENC_RIGHT))   // 오른쪽은 거울 방향으로 달려 있음
+
+void wheel_enc_init(void) {
+    Xil_Out32(ENC_ADDR + ENC_CTRL, 0);
+    Xil_Out32(ENC_ADDR + ENC_TIMEOUT, ENC_TIMEOUT_TICKS);
+    Xil_Out32(ENC_ADDR + ENC_CLEAR, 0xF);
+    Xil_Out32(ENC_ADDR + ENC_CTRL, ENC_INVERT_RIGHT | (ENC_FILTER_TICKS << 8) | 0x1);
+}
+
+void wheel_enc_clear(void) {
+    Xil_Out32(ENC_ADDR + ENC_CLEAR, (1 << WHEEL_ENC_LEFT) | (1 << WHEEL_ENC_RIGHT));
+}
+
+// LATCH 한 번으로 두 바퀴를 같은 클럭에 찍은 뒤 읽음 (읽는 동안 바퀴가 움직여도 값이 서로 맞음)
+void wheel_enc_sample(wheel_enc_sample_t *s) {
+    Xil_Out32(ENC_ADDR + ENC_LATCH, 1);
+    s->stamp = Xil_In32(ENC_ADDR + ENC_STAMP);
+
+    for (int ch = 0; ch < WHEEL_ENC_COUNT; ch++) {
+        int32_t period = (int32_t)Xil_In32(ENC_ADDR + ENC_PERIOD(ch));
+        s->pos[ch] = (int32_t)Xil_In32(ENC_ADDR + ENC_POS(ch));
+        s->speed[ch] = period ? SYS_CLK_FREQ / period : 0;
+    }
+}
+
+#else
+
+void wheel_enc_init(void) {}
+void wheel_enc_clear(void) {}
+
+void wheel_enc_sample(wheel_enc_sample_t *s) {
+    s->stamp = 0;
+    for (int ch = 0; ch < WHEEL_ENC_COUNT; ch++) {
+        s->pos[ch] = 0;
+        s->speed[ch] = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef WHEEL_ENC_H
+#define WHEEL_ENC_H
+
+#include <stdint.h>
+#include "xparameters.h"
+
+#ifdef XPAR_MYIP_ENCODER_0_BASEADDR
+#define WHEEL_ENC_HW        // 바퀴 엔코더 IP 있음 (없으면 주행은 개루프)
+#endif
+
+// 엔코더 채널 번호 (myip_encoder 채널과 같음)
+enum {
+    WHEEL_ENC_LEFT = 0,
+    WHEEL_ENC_RIGHT,
+    WHEEL_ENC_COUNT
+};
+
+// 한 번의 LATCH로 찍은 두 바퀴 값 (같은 클럭 기준)
+typedef struct {
+    uint32_t stamp;                     // 스냅샷 시각 (100MHz 클럭)
+    int32_t pos[WHEEL_ENC_COUNT];       // 4체배 카운트, +전진
+    int32_t speed[WHEEL_ENC_COUNT];     // 카운트/초, +전진 (정지 시 0)
+} wheel_enc_sample_t;
+
+void wheel_enc_init(void);
+void wheel_enc_clear(void);                     // 두 바퀴 위치를 0으로
+void wheel_enc_sample(wheel_enc_sample_t *s);
+
+#endif
@@ -8,11 +8,30 @@
 #include "xparameters.h"
 #include "sleep.h"
 #include "xiic.h"
+#include "xil_exception.h"
+#include "joy_calib.h"
 
 #define MYIP_BASEADDR XPAR_MYIP_ADC_NEW_0_BASEADDR
 #define UART_BASEADDR XPAR_AXI_UARTLITE_1_BASEADDR // HC-05 연결 UART Lite
 #define BTN_BASE XPAR_MYIP_BTN_0_BASEADDR           // 버튼 베이스 주소 추가
 #define IIC_ADDR XPAR_AXI_IIC_0_BASEADDR           // I2C LCD 주소
+#define CAL_BTN_MASK 0x2                           // 부팅 시 누르고 있으면 min/max 학습
+
+// myip_btn 레지스터
+#define BTN_REG_PEDGE   0x0     // 상승 엣지 이벤트 (읽으면 클리어)
+#define BTN_REG_NEDGE   0x4     // 하강 엣지 이벤트 (읽으면 클리어)
+#define BTN_REG_LEVEL   0x8     // 현재 레벨
+#define BTN_REG_IRQ_EN  0xC     // [3:0] pedge, [7:4] nedge 인터럽트 허용
+
+// btn_intr 를 CPU 인터럽트 핀에 배선한 비트스트림에서만 1 (아니면 메인 루프가 이벤트 레지스터 폴링)
+#ifndef BTN_IRQ_WIRED
+#define BTN_IRQ_WIRED   0
+#endif
+
+// myip_adc_new 레지스터: 0x0~0xC = {필터값[27:16], 원시값[11:0]}
+#define ADC_REG_FILT_CTRL   0x10    // [3:0] IIR 시프트(0=바이패스), [4] 미디언
+#define ADC_FILT_CFG        ((1 << 4) | 3)  // 3-tap 미디언 + 1/8 IIR
+#define ADC_FILT(reg)       (((reg) >> 16) & 0xFFF)
 
 uint32_t adc_scaled[4] = {0,0,0,0};
 XIic iic_instance;
@@ -141,7 +160,43 @@ int simple_uart_send_string(const char* str) {
 
 // 버튼 읽기
 uint32_t read_raw_btn() {
-    return Xil_In32(BTN_BASE + 0x8);
+    return Xil_In32(BTN_BASE + BTN_REG_LEVEL);
+}
+
+// 버튼 인터럽트 (디바운스/엣지 검출은 myip_btn 하드웨어에서 처리)
+// 버튼은 active low라서 누름 = nedge
+volatile uint32_t btn_press_evt = 0;
+
+void btn_isr(void *data) {
+    (void)data;
+    btn_press_evt |= Xil_In32(BTN_BASE + BTN_REG_NEDGE);
+}
+
+void btn_irq_init() {
+    // 부팅 중 쌓인 엣지 비우기
+    Xil_In32(BTN_BASE + BTN_REG_PEDGE);
+    Xil_In32(BTN_BASE + BTN_REG_NEDGE);
+    
+#if BTN_IRQ_WIRED
+    Xil_ExceptionInit();
+    Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, (Xil_ExceptionHandler)btn_isr, NULL);
+    Xil_Out32(BTN_BASE + BTN_REG_IRQ_EN, 0xF0);  // 누름(nedge)만 인터럽트
+    Xil_ExceptionEnable();
+#endif
+}
+
+// 누름 이벤트 가져오기: ISR이 모아 둔 것 + 이벤트 레지스터 직접 읽기
+// (인터럽트가 배선되지 않은 보드에서도 엣지는 읽을 때까지 남아 있음)
+uint32_t take_btn_events() {
+#if BTN_IRQ_WIRED
+    Xil_ExceptionDisable();
+#endif
+    uint32_t evt = btn_press_evt | Xil_In32(BTN_BASE + BTN_REG_NEDGE);
+    btn_press_evt = 0;
+#if BTN_IRQ_WIRED
+    Xil_ExceptionEnable();
+#endif
+    return evt;
 }
 
 // 버튼 + 모드 데이터 전송
@@ -151,19 +206,6 @@ int send_button_mode_data(uint32_t pressed_buttons, int mode) {
     return simple_uart_send_string(buf);
 }
 
-// ADC 보정
-uint32_t remap_adc(uint32_t raw, uint32_t raw_min, uint32_t raw_max) {
-    if(raw_max <= raw_min) return 0;
-    if(raw <= raw_min) return 0;
-    if(raw >= raw_max) return 4095;
-    
-    uint64_t numer = (uint64_t)(raw - raw_min) * 4095;
-    uint32_t denom = raw_max - raw_min;
-    uint32_t result = (uint32_t)(numer / denom);
-    if(result > 4095) result = 4095;
-    return result;
-}
-
 // 조이스틱 + 모드 데이터 전송
 int send_joystick_mode_data(uint32_t *vals, int mode) {
     char buf[128];
@@ -198,75 +240,75 @@ int main() {
     // ADC 보정 상수
     const uint32_t RAW_MIN[4] = {10, 10, 10, 10};
     const uint32_t RAW_MAX[4] = {3000, 3000, 3000, 3000};
-    const uint32_t NEUTRAL[4] = {2048, 2048, 2048, 2048};
     const uint32_t DEADZONE = 300;
     
+    // 조이스틱 보정 (중립 캡처 + 선택적 min/max 학습 후 Q16 스케일 계산)
+    joy_axis_cal_t joy_cal[JOY_AXES];
+    // ADC IP 안에서 스파이크 제거 + 평활 (보정은 원시값 기준, 루프는 필터값 사용)
+    Xil_Out32(MYIP_BASEADDR + ADC_REG_FILT_CTRL, ADC_FILT_CFG);
+    joy_calib_init(joy_cal, RAW_MIN, RAW_MAX);
+#ifndef JOY_CAL_PINNED
+    if ((read_raw_btn() & CAL_BTN_MASK) == 0) {
+        joy_calib_learn_range(joy_cal, MYIP_BASEADDR, BTN_BASE, CAL_BTN_MASK);
+    }
+    joy_calib_capture_neutral(joy_cal, MYIP_BASEADDR);
+#endif
+    joy_calib_finalize(joy_cal);
+    joy_calib_report(joy_cal);
+    
     u32 adc_raw[4];
     int idle_counter = 0;
     int current_mode = 1;  // 현재 모드 (-1: 대기 상태)
     int display_counter = 0;
     
-    // 버튼 디바운싱 변수들
-    uint32_t prev_btn_state = 0xF;  // 초기값: 모든 버튼이 눌리지 않은 상태
-    uint32_t debounce_count = 0;
+    // 버튼 인터럽트 시작
+    btn_irq_init();
     
     // 초기 LCD 표시
     displayExcavatorStatus(current_mode, adc_scaled);
     
     while(1) {
-        // 버튼 상태 읽기 및 디바운싱 처리
-        uint32_t btn_data = read_raw_btn();
+        // 누름 이벤트 처리 (ISR이 모아 둔 것 + 이벤트 레지스터)
+        uint32_t pressed = take_btn_events();
         
-        if (btn_data != prev_btn_state) {
-            debounce_count++;
-            if (debounce_count > 50) {  // 디바운싱 임계값
-                uint32_t pressed = prev_btn_state & (~btn_data);  // 새로 눌린 버튼
-                
-                if (pressed) {
-                    // 버튼에 따른 처리
-                    if (pressed & 0x1) {
-                        // 버튼 0: 버킷 다운 (모드 변경 없음)
-                        send_button_mode_data(pressed, current_mode);
-                        xil_printf("Bucket Down Action\n");
-                    }
-                    else if (pressed & 0x2) {
-                        // 버튼 1: 워크 모드 변경
-                        current_mode = 1;
-                        xil_printf("Work Mode Selected\n");
-                        send_button_mode_data(pressed, current_mode);
-                        displayExcavatorStatus(current_mode, adc_scaled);
-                    }
-                    else if (pressed & 0x4) {
-                        // 버튼 2: 드라이브 모드 변경 - 로컬 LCD만 업데이트, UART로는 현재 모드 전송
-                        current_mode = 2;
-                        xil_printf("Drive Mode Selected\n");
-                        send_button_mode_data(pressed, current_mode);
-                        displayExcavatorStatus(current_mode, adc_scaled);  // 로컬 LCD만 업데이트
-                    }
-                    else if (pressed & 0x8) {
-                        // 버튼 3: 버킷 업 (모드 변경 없음)
-                        send_button_mode_data(pressed, current_mode);
-                        xil_printf("Bucket Up Action\n");
-                    }
-                }
-                
-                prev_btn_state = btn_data;
-                debounce_count = 0;
+        if (pressed) {
+            // 버튼에 따른 처리
+            if (pressed & 0x1) {
+                // 버튼 0: 버킷 다운 (모드 변경 없음)
+                send_button_mode_data(pressed, current_mode);
+                xil_printf("Bucket Down Action\n");
+            }
+            else if (pressed & 0x2) {
+                // 버튼 1: 워크 모드 변경
+                current_mode = 1;
+                xil_printf("Work Mode Selected\n");
+                send_button_mode_data(pressed, current_mode);
+                displayExcavatorStatus(current_mode, adc_scaled);
+            }
+            else if (pressed & 0x4) {
+                // 버튼 2: 드라이브 모드 변경 - 로컬 LCD만 업데이트, UART로는 현재 모드 전송
+                current_mode = 2;
+                xil_printf("Drive Mode Selected\n");
+                send_button_mode_data(pressed, current_mode);
+                displayExcavatorStatus(current_mode, adc_scaled);  // 로컬 LCD만 업데이트
+            }
+            else if (pressed & 0x8) {
+                // 버튼 3: 버킷 업 (모드 변경 없음)
+                send_button_mode_data(pressed, current_mode);
+                xil_printf("Bucket Up Action\n");
             }
-        } else {
-            debounce_count = 0;
         }
         
         // ADC 읽기
         for(int i=0;i<4;i++) {
-            adc_raw[i] = Xil_In32(MYIP_BASEADDR + i*4) & 0xFFF;
-            adc_scaled[i] = remap_adc(adc_raw[i], RAW_MIN[i], RAW_MAX[i]);
+            adc_raw[i] = ADC_FILT(Xil_In32(MYIP_BASEADDR + i*4));
+            adc_scaled[i] = joy_calib_apply(&joy_cal[i], adc_raw[i]);
         }
         
         // 데드존 체크
         int active = 0;
         for(int i=0;i<4;i++) {
-            if(abs((int)adc_scaled[i] - (int)NEUTRAL[i]) > DEADZONE) {
+            if(abs((int)adc_scaled[i] - JOY_OUT_MID) > (int)DEADZONE) {
                 active = 1;
                 break;
             }
@@ -0,0 +1,122 @@
+#include "joy_calib.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+#include "sleep.h"
+
+#ifdef JOY_CAL_PINNED
+static const uint16_t pinned[JOY_AXES][3] = JOY_CAL_PINNED;
+#endif
+
+static uint32_t read_axis(uint32_t adc_base, int i)
+{
+    return Xil_In32(adc_base + i * 4) & 0xFFF;
+}
+
+// 기본값 설정 (고정 보정값이 있으면 그것을 사용)
+void joy_calib_init(joy_axis_cal_t *cal, const uint32_t *raw_min, const uint32_t *raw_max)
+{
+#ifdef JOY_CAL_PINNED
+    (void)raw_min;
+    (void)raw_max;
+#endif
+    for (int i = 0; i < JOY_AXES; i++) {
+#ifdef JOY_CAL_PINNED
+        cal[i].raw_min = pinned[i][0];
+        cal[i].raw_neutral = pinned[i][1];
+        cal[i].raw_max = pinned[i][2];
+#else
+        cal[i].raw_min = raw_min[i];
+        cal[i].raw_max = raw_max[i];
+        cal[i].raw_neutral = (raw_min[i] + raw_max[i]) / 2;
+#endif
+        cal[i].scale_lo = 0;
+        cal[i].scale_hi = 0;
+    }
+}
+
+// 부팅 시 중립 캡처 (스틱에서 손을 뗀 상태)
+void joy_calib_capture_neutral(joy_axis_cal_t *cal, uint32_t adc_base)
+{
+    uint32_t sum[JOY_AXES] = {0, 0, 0, 0};
+
+    for (int n = 0; n < JOY_CAL_NEUTRAL_SAMPLES; n++) {
+        for (int i = 0; i < JOY_AXES; i++) sum[i] += read_axis(adc_base, i);
+        usleep(500);
+    }
+
+    for (int i = 0; i < JOY_AXES; i++) {
+        cal[i].raw_neutral = sum[i] / JOY_CAL_NEUTRAL_SAMPLES;
+    }
+}
+
+// 버튼(active low)을 누르고 있는 동안 스틱을 끝까지 돌려 min/max 학습
+void joy_calib_learn_range(joy_axis_cal_t *cal, uint32_t adc_base, uint32_t btn_base, uint32_t btn_mask)
+{
+    uint32_t lo[JOY_AXES] = {4095, 4095, 4095, 4095};
+    uint32_t hi[JOY_AXES] = {0, 0, 0, 0};
+
+    xil_printf("CAL: move sticks to all corners, release button to finish\r\n");
+
+    while ((Xil_In32(btn_base + 0x8) & btn_mask) == 0) {
+        for (int i = 0; i < JOY_AXES; i++) {
+            uint32_t raw = read_axis(adc_base, i);
+            if (raw < lo[i]) lo[i] = raw;
+            if (raw > hi[i]) hi[i] = raw;
+        }
+        usleep(1000);
+    }
+
+    for (int i = 0; i < JOY_AXES; i++) {
+        if (hi[i] > lo[i] + 2 * JOY_CAL_MIN_SPAN) {
+            cal[i].raw_min = lo[i];
+            cal[i].raw_max = hi[i];
+        } else {
+            xil_printf("CAL: axis %d range too small, keeping default\r\n", i);
+        }
+    }
+
+    // 버튼을 뗀 뒤 스틱이 중립으로 돌아올 시간
+    usleep(300000);
+}
+
+// Q16 역수 스케일 계산 (나눗셈은 여기서 한 번만)
+void joy_calib_finalize(joy_axis_cal_t *cal)
+{
+    for (int i = 0; i < JOY_AXES; i++) {
+        joy_axis_cal_t *c = &cal[i];
+
+        if (c->raw_max > 4095) c->raw_max = 4095;
+        if (c->raw_max < c->raw_min + 2 * JOY_CAL_MIN_SPAN) {
+            xil_printf("CAL: axis %d invalid range %u..%u, using full scale\r\n",
+                i, c->raw_min, c->raw_max);
+            c->raw_min = 0;
+            c->raw_max = 4095;
+        }
+
+        if (c->raw_neutral < c->raw_min + JOY_CAL_MIN_SPAN) {
+            c->raw_neutral = c->raw_min + JOY_CAL_MIN_SPAN;
+        } else if (c->raw_neutral > c->raw_max - JOY_CAL_MIN_SPAN) {
+            c->raw_neutral = c->raw_max - JOY_CAL_MIN_SPAN;
+        }
+
+        uint32_t span_lo = c->raw_neutral - c->raw_min;
+        uint32_t span_hi = c->raw_max - c->raw_neutral;
+        c->scale_lo = (((uint32_t)JOY_OUT_MID << 16) + span_lo / 2) / span_lo;
+        c->scale_hi = (((uint32_t)(JOY_OUT_MAX - JOY_OUT_MID) << 16) + span_hi / 2) / span_hi;
+    }
+}
+
+// USB로 보정값 출력 (CAL PIN 줄은 JOY_CAL_PINNED에 그대로 사용 가능)
+void joy_calib_report(const joy_axis_cal_t *cal)
+{
+    for (int i = 0; i < JOY_AXES; i++) {
+        xil_printf("CAL ax%d min=%u neu=%u max=%u lo=0x%08x hi=0x%08x\r\n", i,
+            cal[i].raw_min, cal[i].raw_neutral, cal[i].raw_max,
+            cal[i].scale_lo, cal[i].scale_hi);
+    }
+    xil_printf("CAL PIN {{%u,%u,%u},{%u,%u,%u},{%u,%u,%u},{%u,%u,%u}}\r\n",
+        cal[0].raw_min, cal[0].raw_neutral, cal[0].raw_max,
+        cal[1].raw_min, cal[1].raw_neutral, cal[1].raw_max,
+        cal[2].raw_min, cal[2].raw_neutral, cal[2].raw_max,
+        cal[3].raw_min, cal[3].raw_neutral, cal[3].raw_max);
+}
@@ -30,6 +30,10 @@ set(USER_INCLUDE_DIRECTORIES
 set(USER_COMPILE_SOURCES
 "helloworld.c"
 "platform.c"
+"joy_calib.c"
+"i2c_bus.c"
+"sched.c"
+"link_tx.c"
 )
 
 # -----------------------------------------
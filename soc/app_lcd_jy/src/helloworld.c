@@ -8,16 +8,66 @@
 #include "xparameters.h"
 #include "sleep.h"
 #include "xiic.h"
+#include "xil_exception.h"
+#include "joy_calib.h"
+#include "sched.h"
+#include "i2c_bus.h"
+#include "link_tx.h"
 
 #define MYIP_BASEADDR XPAR_MYIP_ADC_NEW_0_BASEADDR
 #define UART_BASEADDR XPAR_AXI_UARTLITE_1_BASEADDR 
 #define BTN_BASE XPAR_MYIP_BTN_0_BASEADDR           
 #define IIC_ADDR XPAR_AXI_IIC_0_BASEADDR           
+#define LCD_I2C_ADDR 0x27   // PCF8574 백팩
+#define CAL_BTN_MASK 0x2    // 부팅 시 이 버튼을 누르고 있으면 min/max 학습
+
+// myip_btn 레지스터
+#define BTN_REG_PEDGE   0x0     // 상승 엣지 이벤트 (읽으면 클리어)
+#define BTN_REG_NEDGE   0x4     // 하강 엣지 이벤트 (읽으면 클리어)
+#define BTN_REG_LEVEL   0x8     // 현재 레벨
+#define BTN_REG_IRQ_EN  0xC     // [3:0] pedge, [7:4] nedge 인터럽트 허용
+
+// btn_intr | adc_intr 를 CPU 인터럽트 핀에 배선한 비트스트림에서만 1 (아니면 태스크가 이벤트 레지스터 폴링)
+#ifndef INPUT_IRQ_WIRED
+#define INPUT_IRQ_WIRED 0
+#endif
+
+// myip_adc_new 레지스터: 0x0~0xC = {필터값[27:16], 원시값[11:0]}
+#define ADC_REG_FILT_CTRL   0x10    // [3:0] IIR 시프트(0=바이패스), [4] 미디언
+#define ADC_FILT_CFG        ((1 << 4) | 3)  // 3-tap 미디언 + 1/8 IIR
+#define ADC_FILT(reg)       (((reg) >> 16) & 0xFFF)
+#define ADC_REG_CMP_CTRL    0x14    // [3:0] 채널 사용, [8] 인터럽트, [9] 필터값 비교
+#define ADC_REG_CHANGED     0x18    // [3:0] 변화 채널 (읽으면 클리어), [7:4] 데드존 밖
+#define ADC_REG_ZONE(n)     (0x20 + (n) * 4)    // {데드존[27:16], 중립[11:0]}
+#define ADC_REG_THRESH(n)   (0x30 + (n) * 4)    // 임계값[11:0], 읽기 [27:16] = 보고값
+#define ADC_DELTA_RAW       8       // 이보다 작은 움직임은 보고하지 않음 (원시값 단위)
+
+#define TX_RING_SIZE 256
+#define TX_OOB_SIZE  8      // 대역 외 제어 바이트 큐 (TX_RING 보다 먼저 나감)
 
 uint32_t adc_scaled[4] = {0,0,0,0};
 XIic iic_instance;
 
 // LCD 제어
+// myip_i2c가 있으면 큐에 넣고 바로 반환 (전송은 "i2c" 태스크가 FIFO로 밀어넣음)
+static void lcd_send(uint8_t *buf)
+{
+#ifdef I2C_BUS_HW
+    i2c_bus_write(LCD_I2C_ADDR, buf, 4);
+#else
+    XIic_Send(IIC_ADDR, LCD_I2C_ADDR, buf, 4, XIIC_STOP);
+#endif
+}
+
+// 초기화 중 지연은 버스에 실제로 나간 뒤부터 세야 함
+static void lcd_wait(unsigned int ms)
+{
+#ifdef I2C_BUS_HW
+    i2c_bus_sync();
+#endif
+    msleep(ms);
+}
+
 void lcdCommand(uint8_t command)
 {
     uint8_t high_nibble = command & 0xf0;
@@ -29,7 +79,7 @@ void lcdCommand(uint8_t command)
     i2c_buffer[2] = low_nibble | 0x0C;
     i2c_buffer[3] = low_nibble | 0x08;
     
-    XIic_Send(IIC_ADDR, 0x27, i2c_buffer, 4, XIIC_STOP);
+    lcd_send(i2c_buffer);
 }
 
 void lcdData(uint8_t data)
@@ -43,24 +93,24 @@ void lcdData(uint8_t data)
     i2c_buffer[2] = low_nibble | 0x0D;
     i2c_buffer[3] = low_nibble | 0x09;
     
-    XIic_Send(IIC_ADDR, 0x27, i2c_buffer, 4, XIIC_STOP);
+    lcd_send(i2c_buffer);
 }
 
 void lcdInit()
 {
-    msleep(50);
+    lcd_wait(50);
     lcdCommand(0x33);
-    msleep(5);
+    lcd_wait(5);
     lcdCommand(0x32);
-    msleep(5);
+    lcd_wait(5);
     lcdCommand(0x28);
-    msleep(5);
+    lcd_wait(5);
     lcdCommand(0x0C);
-    msleep(5);
+    lcd_wait(5);
     lcdCommand(0x06);
-    msleep(5);
+    lcd_wait(5);
     lcdCommand(0x01);
-    msleep(2);
+    lcd_wait(2);
 }
 
 void lcdString(char *str)
@@ -76,7 +126,7 @@ void moveCursor(uint8_t row, uint8_t col)
 void lcdClear()
 {
     lcdCommand(0x01);
-    msleep(2);
+    lcd_wait(2);
 }
 
 void displayExcavatorStatus(int mode, uint32_t *joystick_vals)
@@ -84,17 +134,17 @@ void displayExcavatorStatus(int mode, uint32_t *joystick_vals)
     char line1[17];
     char line2[17];
     
+    // 16칸을 공백으로 채워 덮어쓰므로 lcdClear()의 2ms 대기가 필요 없음
     switch(mode) {
-        case 0: sprintf(line1, "BUCKET DOWN"); break;
-        case 1: sprintf(line1, "WORK MODE"); break;
-        case 2: sprintf(line1, "DRIVE MODE"); break;
-        case 3: sprintf(line1, "BUCKET UP"); break;
-        default: sprintf(line1, "EXCAVATOR READY"); break;
+        case 0: sprintf(line1, "%-16s", "BUCKET DOWN"); break;
+        case 1: sprintf(line1, "%-16s", "WORK MODE"); break;
+        case 2: sprintf(line1, "%-16s", "DRIVE MODE"); break;
+        case 3: sprintf(line1, "%-16s", "BUCKET UP"); break;
+        default: sprintf(line1, "%-16s", "EXCAVATOR READY"); break;
     }
     
-    sprintf(line2, "STATUS: OK");
+    sprintf(line2, "%-16s", "STATUS: OK");
     
-    lcdClear();
     moveCursor(0, 0);
     lcdString(line1);
     moveCursor(1, 0);
@@ -133,11 +183,135 @@ int safe_uart_send_string(const char* str) {
     return 0;
 }
 
+// UART 송신 링버퍼: 프레임은 큐에 넣고 uart 태스크가 FIFO가 빌 때마다 채움
+char tx_ring[TX_RING_SIZE];
+uint32_t tx_head = 0, tx_tail = 0;
+
+int uart_tx_queue_bytes(const uint8_t* buf, uint32_t len) {
+    uint32_t used = tx_head - tx_tail;
+    
+    if (len > TX_RING_SIZE - used) return -1;  // 프레임을 쪼개 보내지 않음
+    
+    for(uint32_t i = 0; i < len; i++) {
+        tx_ring[tx_head++ % TX_RING_SIZE] = buf[i];
+    }
+    return 0;
+}
+
+int uart_tx_queue(const char* str) {
+    return uart_tx_queue_bytes((const uint8_t*)str, strlen(str));
+}
+
+// 제어 바이트 큐: 링버퍼에 남은 프레임보다 먼저 FIFO로 들어감
+uint8_t tx_oob[TX_OOB_SIZE];
+uint32_t tx_oob_head = 0, tx_oob_tail = 0;
+
+int uart_tx_inject(uint8_t code) {
+    if (tx_oob_head - tx_oob_tail >= TX_OOB_SIZE) return -1;
+    tx_oob[tx_oob_head++ % TX_OOB_SIZE] = code;
+    return 0;
+}
+
+// 이진 프레임은 모두 LINK_FRAME_LEN 바이트: 보낸 바이트를 프레임 단위로 세어 프레임 사이만 허용
+uint32_t tx_frame_pos = 0;
+
+static int tx_at_boundary() {
+#if LINK_TX_FRAMES
+    return tx_frame_pos == 0;
+#else
+    return 1;
+#endif
+}
+
+void uart_tx_pump() {
+    while (!(Xil_In32(UART_BASEADDR + 0x8) & 0x08)) {
+        if (tx_oob_tail != tx_oob_head && tx_at_boundary()) {
+            Xil_Out8(UART_BASEADDR + 0x4, tx_oob[tx_oob_tail++ % TX_OOB_SIZE]);
+        }
+        else if (tx_tail != tx_head) {
+            Xil_Out8(UART_BASEADDR + 0x4, tx_ring[tx_tail++ % TX_RING_SIZE]);
+            if (++tx_frame_pos == LINK_FRAME_LEN) tx_frame_pos = 0;
+        }
+        else break;
+    }
+}
+
 uint32_t read_raw_btn() {
-    return Xil_In32(BTN_BASE + 0x8);
+    return Xil_In32(BTN_BASE + BTN_REG_LEVEL);
+}
+
+// 버튼 인터럽트: 버튼은 active low라서 누름 = nedge, 뗌 = pedge
+volatile uint32_t btn_press_evt = 0;   // 메인 루프가 아직 처리하지 않은 누름
+volatile uint32_t btn_held = 0;        // 현재 눌려 있는 버튼
+
+volatile uint32_t adc_changed_evt = 0; // 값이 바뀐 ADC 채널
+
+// 엣지 이벤트 레지스터를 읽어 누름/눌림 상태에 반영 (ISR, 폴링 공용)
+static void btn_collect() {
+    uint32_t press = Xil_In32(BTN_BASE + BTN_REG_NEDGE);
+    uint32_t release = Xil_In32(BTN_BASE + BTN_REG_PEDGE);
+    
+    btn_press_evt |= press;
+    btn_held = (btn_held | press) & ~release;
+}
+
+// 인터럽트 컨트롤러가 없어 btn_intr | adc_intr 한 줄을 같이 받음
+void input_isr(void *data) {
+    (void)data;
+    btn_collect();
+    adc_changed_evt |= Xil_In32(MYIP_BASEADDR + ADC_REG_CHANGED) & 0xF;
+}
+
+static void input_irq_off() {
+#if INPUT_IRQ_WIRED
+    Xil_ExceptionDisable();
+#endif
+}
+
+static void input_irq_on() {
+#if INPUT_IRQ_WIRED
+    Xil_ExceptionEnable();
+#endif
+}
+
+void btn_irq_init() {
+    // 부팅 중 쌓인 엣지 비우기 (디바운서 초기화 시 생기는 엣지 포함)
+    Xil_In32(BTN_BASE + BTN_REG_PEDGE);
+    Xil_In32(BTN_BASE + BTN_REG_NEDGE);
+    btn_held = ~read_raw_btn() & 0xF;
+    
+#if INPUT_IRQ_WIRED
+    Xil_ExceptionInit();
+    Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, (Xil_ExceptionHandler)input_isr, NULL);
+    Xil_Out32(BTN_BASE + BTN_REG_IRQ_EN, 0xFF);
+    Xil_ExceptionEnable();
+#endif
+}
+
+// 누름 이벤트 가져오기 (ISR과 경쟁하지 않도록 잠깐 인터럽트 차단)
+// 인터럽트가 배선되지 않은 보드에서도 엣지는 읽을 때까지 남아 있으므로 여기서 한 번 직접 읽음
+uint32_t take_btn_events() {
+    input_irq_off();
+    btn_collect();
+    uint32_t evt = btn_press_evt;
+    btn_press_evt = 0;
+    input_irq_on();
+    return evt;
+}
+
+uint32_t take_adc_events() {
+    input_irq_off();
+    uint32_t evt = adc_changed_evt;
+    adc_changed_evt = 0;
+    input_irq_on();
+    return evt;
 }
 
 int send_button_mode_data(uint32_t pressed_buttons, int mode) {
+#if LINK_TX_FRAMES
+    uint8_t frame[LINK_FRAME_LEN];
+    return uart_tx_queue_bytes(frame, link_tx_build(frame, mode, pressed_buttons, 0, NULL));
+#else
     char buf[32];
     
     int len = snprintf(buf, sizeof(buf)-1, "BTN=%02u MODE=%d\n", 
@@ -148,24 +322,11 @@ int send_button_mode_data(uint32_t pressed_buttons, int mode) {
         return -1;
     }
     
-    return safe_uart_send_string(buf);
-}
-
-uint32_t remap_adc(uint32_t raw, uint32_t raw_min, uint32_t raw_max) {
-    if(raw_max <= raw_min) return 0;
-    if(raw <= raw_min) return 0;
-    if(raw >= raw_max) return 4095;
-    
-    uint64_t numer = (uint64_t)(raw - raw_min) * 4095;
-    uint32_t denom = raw_max - raw_min;
-    uint32_t result = (uint32_t)(numer / denom);
-    if(result > 4095) result = 4095;
-    return result;
+    return uart_tx_queue(buf);
+#endif
 }
 
 int send_joystick_mode_data(uint32_t *vals, int mode) {
-    char buf[64];
-    
     for(int i = 0; i < 4; i++) {
         if(vals[i] > 4095) {
             xil_printf("Invalid ADC value[%d]: %u\r\n", i, vals[i]);
@@ -173,19 +334,32 @@ int send_joystick_mode_data(uint32_t *vals, int mode) {
         }
     }
     
+#if LINK_TX_FRAMES
+    uint8_t frame[LINK_FRAME_LEN];
+    uint16_t axes[4] = { vals[3], vals[2], vals[1], vals[0] };     // X1, Y1, X2, Y2
+    return uart_tx_queue_bytes(frame, link_tx_build(frame, mode, 0, LINK_FLAG_AXES, axes));
+#else
+    char buf[64];
+    
+    // T= 송신 시각 (ms): 수신부 재생 버퍼용, 예전 수신부는 모르는 키라 무시
     int len = snprintf(buf, sizeof(buf)-1,
-        "MODE=%d X1=%04u Y1=%04u X2=%04u Y2=%04u\n",
-        mode, vals[3], vals[2], vals[1], vals[0]);
+        "MODE=%d X1=%04u Y1=%04u X2=%04u Y2=%04u T=%u\n",
+        mode, vals[3], vals[2], vals[1], vals[0], (unsigned)link_tx_stamp());
     
     if (len >= sizeof(buf)) {
         xil_printf("Buffer overflow in send_joystick_mode_data\r\n");
         return -1;
     }
     
-    return safe_uart_send_string(buf);
+    return uart_tx_queue(buf);
+#endif
 }
 
 int send_neutral_mode(int mode) {
+#if LINK_TX_FRAMES
+    uint8_t frame[LINK_FRAME_LEN];
+    return uart_tx_queue_bytes(frame, link_tx_build(frame, mode, 0, LINK_FLAG_NEUTRAL, NULL));
+#else
     char buf[32];
     
     int len = snprintf(buf, sizeof(buf)-1, "MODE=%d NEUTRAL=1\n", mode);
@@ -195,14 +369,136 @@ int send_neutral_mode(int mode) {
         return -1;
     }
     
-    return safe_uart_send_string(buf);
+    return uart_tx_queue(buf);
+#endif
+}
+
+// 송신부 상태 (태스크 간 공유)
+#define DEADZONE 300
+
+joy_axis_cal_t joy_cal[JOY_AXES];
+int current_mode = 1;
+int joy_active = 0;
+int idle_counter = 0;
+
+// 버튼 처리 (20ms): 이벤트는 ISR이 모아 두거나 여기서 이벤트 레지스터를 읽음
+void task_buttons() {
+    uint32_t pressed = take_btn_events();
+    uint32_t bucket = (btn_held | pressed) & 0x9;  // 짧게 눌렀다 뗀 것도 한 번은 전송
+    
+    if (bucket & 0x1) {
+        send_button_mode_data(0x1, current_mode);
+        xil_printf("Bucket Down\n");
+    }
+    if (bucket & 0x8) {
+        send_button_mode_data(0x8, current_mode);
+        xil_printf("Bucket Up\n");
+    }
+    
+    // 모드 전환은 제어 바이트로 먼저 알리고, 버튼 줄/프레임은 예전 수신부용으로 그대로
+    if (pressed & 0x2) {
+        current_mode = 1;
+        xil_printf("Work Mode\n");
+        uart_tx_inject(LINK_OOB_WORK);
+        send_button_mode_data(0x2, current_mode);
+        displayExcavatorStatus(current_mode, adc_scaled);
+    }
+    if (pressed & 0x4) {
+        current_mode = 2;
+        xil_printf("Drive Mode\n");
+        uart_tx_inject(LINK_OOB_DRIVE);
+        send_button_mode_data(0x4, current_mode);
+        displayExcavatorStatus(current_mode, adc_scaled);
+    }
 }
 
+// ADC 변화 검출 설정: 보정된 중립과 데드존(원시값 단위)을 IP에 넣음
+void adc_cmp_init() {
+    for(int i=0;i<4;i++) {
+        uint32_t span_lo = joy_cal[i].raw_neutral - joy_cal[i].raw_min;
+        uint32_t span_hi = joy_cal[i].raw_max - joy_cal[i].raw_neutral;
+        uint32_t span = (span_lo < span_hi) ? span_lo : span_hi;
+        uint32_t dz = DEADZONE * span / JOY_OUT_MID;   // 좁은 쪽 기준이라 소프트웨어 데드존보다 넓지 않음
+        
+        Xil_Out32(MYIP_BASEADDR + ADC_REG_ZONE(i), (dz << 16) | joy_cal[i].raw_neutral);
+        Xil_Out32(MYIP_BASEADDR + ADC_REG_THRESH(i), ADC_DELTA_RAW);
+    }
+    Xil_In32(MYIP_BASEADDR + ADC_REG_CHANGED);
+    Xil_Out32(MYIP_BASEADDR + ADC_REG_CMP_CTRL, 0xF | (1 << 8) | (1 << 9));
+}
+
+// 바뀐 채널만 보정 + 데드존 (1ms)
+// 인터럽트가 배선되지 않은 보드도 있어서 변화 레지스터 한 번은 직접 읽음
+void task_adc() {
+    uint32_t changed = take_adc_events() | (Xil_In32(MYIP_BASEADDR + ADC_REG_CHANGED) & 0xF);
+    int active = 0;
+    
+    if (!changed) return;
+    
+    for(int i=0;i<4;i++) {
+        if (changed & (1 << i)) {
+            uint32_t raw = (Xil_In32(MYIP_BASEADDR + ADC_REG_THRESH(i)) >> 16) & 0xFFF;
+            adc_scaled[i] = joy_calib_apply(&joy_cal[i], raw);
+        }
+        if(abs((int)adc_scaled[i] - JOY_OUT_MID) > DEADZONE) active = 1;
+    }
+    joy_active = active;
+}
+
+// 조이스틱 프레임 송신 (20ms, 38400bps 링크에 맞춘 주기)
+void task_frame() {
+    if(joy_active) {
+        idle_counter = 0;
+        
+        int result = send_joystick_mode_data(adc_scaled, current_mode);
+        if (result != 0) {
+            xil_printf("UART send failed!\n");
+        }
+        
+        xil_printf("MODE=%d,X1=%04u,Y1=%04u,X2=%04u,Y2=%04u\n",
+            current_mode, adc_scaled[3], adc_scaled[2],
+            adc_scaled[1], adc_scaled[0]);
+    } else {
+        idle_counter++;
+        if(idle_counter == 1) {
+            send_neutral_mode(current_mode);
+            xil_printf("Neutral\n");
+        }
+    }
+}
+
+// LCD 갱신 (500ms)
+void task_lcd() {
+    displayExcavatorStatus(current_mode, adc_scaled);
+}
+
+// 스케줄러 통계 USB 출력 (5s)
+void task_stats() {
+    sched_report();
+}
+
+//                    name     함수           주기(us)  데드라인(us)
+sched_task_t tasks[] = {
+    SCHED_TASK("uart",  uart_tx_pump,    1000,    200),
+#ifdef I2C_BUS_HW
+    SCHED_TASK("i2c",   i2c_bus_pump,    1000,    200),
+#endif
+    SCHED_TASK("adc",   task_adc,        1000,    500),
+    SCHED_TASK("btn",   task_buttons,   20000,   5000),
+    SCHED_TASK("frame", task_frame,     20000,   5000),
+    SCHED_TASK("lcd",   task_lcd,      500000,  50000),
+    SCHED_TASK("stat",  task_stats,   5000000, 100000),
+};
+
 int main() {
     init_platform();
     print("=== Excavator Control System - Basys3 ===\n\r");
     
+#ifdef I2C_BUS_HW
+    i2c_bus_init(I2C_100KHZ);
+#else
     XIic_Initialize(&iic_instance, IIC_ADDR);
+#endif
     lcdInit();
     
     usleep(100000);
@@ -214,91 +510,28 @@ int main() {
     
     const uint32_t RAW_MIN[4] = {120, 120, 120, 120};
     const uint32_t RAW_MAX[4] = {3000, 3000, 3000, 3000};
-    const uint32_t NEUTRAL[4] = {2048, 2048, 2048, 2048};
-    const uint32_t DEADZONE = 300;
-    
-    u32 adc_raw[4];
-    int idle_counter = 0;
-    int current_mode = 1;
-    int display_counter = 0;
-    int send_counter = 0;
     
-    uint32_t prev_btn_state = 0xF;
+    // 조이스틱 보정: 중립은 부팅 시 캡처, min/max는 버튼을 누른 채 부팅하면 학습
+    // ADC IP 안에서 스파이크 제거 + 평활 (보정은 원시값 기준, 루프는 필터값 사용)
+    Xil_Out32(MYIP_BASEADDR + ADC_REG_FILT_CTRL, ADC_FILT_CFG);
+    joy_calib_init(joy_cal, RAW_MIN, RAW_MAX);
+#ifndef JOY_CAL_PINNED
+    if ((read_raw_btn() & CAL_BTN_MASK) == 0) {
+        joy_calib_learn_range(joy_cal, MYIP_BASEADDR, BTN_BASE, CAL_BTN_MASK);
+    }
+    joy_calib_capture_neutral(joy_cal, MYIP_BASEADDR);
+#endif
+    joy_calib_finalize(joy_cal);
+    joy_calib_report(joy_cal);
     
+    adc_cmp_init();
+    btn_irq_init();
     displayExcavatorStatus(current_mode, adc_scaled);
     
+    // 태스크마다 자기 주기로 실행, 남는 시간은 sleep 없이 다음 릴리즈를 기다림
+    sched_init(tasks, sizeof(tasks) / sizeof(tasks[0]));
     while(1) {
-        uint32_t btn_data = read_raw_btn();
-
-        if ((btn_data & 0x1) == 0 && send_counter % 10 == 0) {
-            send_button_mode_data(0x1, current_mode);
-            xil_printf("Bucket Down\n");
-        }
-        if ((btn_data & 0x8) == 0 && send_counter % 10 == 0) {
-            send_button_mode_data(0x8, current_mode);
-            xil_printf("Bucket Up\n");
-        }
-
-        uint32_t pressed_1_2 = (prev_btn_state & (~btn_data)) & 0x6;
-        if (pressed_1_2) {
-            if (pressed_1_2 & 0x2) {
-                current_mode = 1;
-                xil_printf("Work Mode\n");
-                send_button_mode_data(0x2, current_mode);
-                displayExcavatorStatus(current_mode, adc_scaled);
-            }
-            if (pressed_1_2 & 0x4) {
-                current_mode = 2;
-                xil_printf("Drive Mode\n");
-                send_button_mode_data(0x4, current_mode);
-                displayExcavatorStatus(current_mode, adc_scaled);
-            }
-        }
-
-        prev_btn_state = (prev_btn_state & 0x9) | (btn_data & 0x6);
-        
-        for(int i=0;i<4;i++) {
-            adc_raw[i] = Xil_In32(MYIP_BASEADDR + i*4) & 0xFFF;
-            adc_scaled[i] = remap_adc(adc_raw[i], RAW_MIN[i], RAW_MAX[i]);
-        }
-        
-        int active = 0;
-        for(int i=0;i<4;i++) {
-            if(abs((int)adc_scaled[i] - (int)NEUTRAL[i]) > DEADZONE) {
-                active = 1;
-                break;
-            }
-        }
-        
-        if(send_counter % 10 == 0) {
-            if(active) {
-                idle_counter = 0;
-                
-                int result = send_joystick_mode_data(adc_scaled, current_mode);
-                if (result != 0) {
-                    xil_printf("UART send failed!\n");
-                }
-                
-                xil_printf("MODE=%d,X1=%04u,Y1=%04u,X2=%04u,Y2=%04u\n",
-                    current_mode, adc_scaled[3], adc_scaled[2],
-                    adc_scaled[1], adc_scaled[0]);
-            } else {
-                idle_counter++;
-                if(idle_counter == 1) {
-                    send_neutral_mode(current_mode);
-                    xil_printf("Neutral\n");
-                }
-            }
-        }
-        
-        display_counter++;
-        if(display_counter >= 500) {
-            displayExcavatorStatus(current_mode, adc_scaled);
-            display_counter = 0;
-        }
-        
-        send_counter++;
-        usleep(1000);
+        sched_run_pending();
     }
     
     cleanup_platform();
@@ -0,0 +1,112 @@
+#include "i2c_bus.h"
+
+#ifdef I2C_BUS_HW
+#include "xil_io.h"
+
+#define I2C_ADDR            XPAR_MYIP_I2C_0_BASEADDR
+#define I2C_CLK_HZ          XPAR_CPU_CORE_CLOCK_FREQ_HZ
+
+// myip_i2c 레지스터 (ip_repo/myip_i2c_1_0/regmap.json)
+#define I2C_CTRL            0x00
+#define I2C_PRESCALE        0x04
+#define I2C_TX              0x08
+#define I2C_RX              0x0C
+#define I2C_STATUS          0x10
+#define I2C_IRQ             0x14
+#define I2C_FLUSH           0x18
+
+#define I2C_TX_START        (1 << 8)
+#define I2C_TX_STOP         (1 << 9)
+#define I2C_TX_READ         (1 << 10)
+#define I2C_TX_NACK         (1 << 11)
+#define I2C_RX_VALID        (1 << 8)
+#define I2C_ST_BUSY         (1 << 0)
+#define I2C_ST_TX_FULL      (1 << 1)
+#define I2C_ST_TX_EMPTY     (1 << 2)
+#define I2C_IRQ_DONE        (1 << 0)
+#define I2C_IRQ_NACK        (1 << 1)
+#define I2C_FIFO_DEPTH      16
+
+static uint16_t ring[I2C_BUS_RING];
+static uint32_t ring_head, ring_tail;
+static uint32_t nack_cnt;
+
+void i2c_bus_init(uint32_t scl_hz)
+{
+    Xil_Out32(I2C_ADDR + I2C_CTRL, 0);
+    Xil_Out32(I2C_ADDR + I2C_FLUSH, 0x3);
+    Xil_Out32(I2C_ADDR + I2C_PRESCALE, (I2C_CLK_HZ / 4 + scl_hz - 1) / scl_hz);
+    Xil_In32(I2C_ADDR + I2C_IRQ);
+    Xil_Out32(I2C_ADDR + I2C_CTRL, 1);
+    ring_head = ring_tail = 0;
+    nack_cnt = 0;
+}
+
+// 트랜잭션 하나 (START + 주소 + 데이터 + STOP)를 통째로 큐에 넣음: 쪼개 넣지 않음
+int i2c_bus_write(uint8_t addr, const uint8_t *buf, int len)
+{
+    uint32_t used = ring_head - ring_tail;
+    if (len < 1 || (uint32_t)len + 1 > I2C_BUS_RING - used) return -1;
+
+    ring[ring_head++ % I2C_BUS_RING] = I2C_TX_START | (addr << 1);
+    for (int i = 0; i < len; i++) {
+        uint16_t w = buf[i];
+        if (i == len - 1) w |= I2C_TX_STOP;
+        ring[ring_head++ % I2C_BUS_RING] = w;
+    }
+    return 0;
+}
+
+void i2c_bus_pump(void)
+{
+    while (ring_tail != ring_head && !(Xil_In32(I2C_ADDR + I2C_STATUS) & I2C_ST_TX_FULL)) {
+        Xil_Out32(I2C_ADDR + I2C_TX, ring[ring_tail++ % I2C_BUS_RING]);
+    }
+    if (Xil_In32(I2C_ADDR + I2C_IRQ) & I2C_IRQ_NACK) nack_cnt++;
+}
+
+void i2c_bus_sync(void)
+{
+    do {
+        i2c_bus_pump();
+    } while (ring_tail != ring_head ||
+             (Xil_In32(I2C_ADDR + I2C_STATUS) & (I2C_ST_BUSY | I2C_ST_TX_EMPTY)) != I2C_ST_TX_EMPTY);
+}
+
+// 센서 레지스터 읽기: {START 주소+W} {reg} {START 주소+R} {읽기 x len, 마지막 NACK+STOP}
+int i2c_bus_read(uint8_t addr, uint8_t reg, uint8_t *buf, int len)
+{
+    if (len < 1 || len > I2C_FIFO_DEPTH - 3) return -1;
+
+    i2c_bus_sync();
+    Xil_In32(I2C_ADDR + I2C_IRQ);
+    Xil_Out32(I2C_ADDR + I2C_TX, I2C_TX_START | (addr << 1));
+    Xil_Out32(I2C_ADDR + I2C_TX, reg);
+    Xil_Out32(I2C_ADDR + I2C_TX, I2C_TX_START | (addr << 1) | 1);
+    for (int i = 0; i < len; i++) {
+        uint32_t w = I2C_TX_READ;
+        if (i == len - 1) w |= I2C_TX_NACK | I2C_TX_STOP;
+        Xil_Out32(I2C_ADDR + I2C_TX, w);
+    }
+
+    // IRQ 는 읽으면 지워짐: NACK 이 DONE 보다 먼저 올라오므로 읽은 값을 모아서 봄
+    uint32_t irq = 0;
+    while (!((irq |= Xil_In32(I2C_ADDR + I2C_IRQ)) & I2C_IRQ_DONE));
+    if (irq & I2C_IRQ_NACK) {
+        nack_cnt++;
+        Xil_Out32(I2C_ADDR + I2C_FLUSH, 0x2);
+        return -1;
+    }
+
+    for (int i = 0; i < len; i++) {
+        buf[i] = Xil_In32(I2C_ADDR + I2C_RX) & 0xFF;
+    }
+    return 0;
+}
+
+uint32_t i2c_bus_nacks(void)
+{
+    return nack_cnt;
+}
+
+#endif
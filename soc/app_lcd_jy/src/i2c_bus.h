@@ -0,0 +1,25 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include "xparameters.h"
+
+#ifdef XPAR_MYIP_I2C_0_BASEADDR
+#define I2C_BUS_HW          // 자체 FIFO I2C 마스터 (없으면 axi_iic + XIic_Send)
+
+#define I2C_BUS_RING        512     // 소프트웨어 명령 큐 (IP FIFO는 16칸)
+
+// SCL 속도 (PCF8574 LCD 백팩은 100kHz까지)
+#define I2C_100KHZ          100000
+#define I2C_400KHZ          400000
+#define I2C_1MHZ            1000000
+
+void i2c_bus_init(uint32_t scl_hz);
+int i2c_bus_write(uint8_t addr, const uint8_t *buf, int len);   // 큐에 넣고 바로 반환 (자리 없으면 -1)
+int i2c_bus_read(uint8_t addr, uint8_t reg, uint8_t *buf, int len);   // 반복 START 레지스터 읽기, 끝날 때까지 대기
+void i2c_bus_pump(void);            // 큐 → IP FIFO (태스크에서 주기적으로)
+void i2c_bus_sync(void);            // 큐와 버스가 빌 때까지 대기
+uint32_t i2c_bus_nacks(void);       // 지금까지 NACK 받은 트랜잭션 수
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef JOY_CALIB_H
+#define JOY_CALIB_H
+
+#include <stdint.h>
+
+#define JOY_AXES            4
+#define JOY_OUT_MAX         4095
+#define JOY_OUT_MID         2048
+#define JOY_CAL_MIN_SPAN    256     // 중립~끝점 최소 폭 (이보다 좁으면 기본값 사용)
+#define JOY_CAL_NEUTRAL_SAMPLES 64  // 부팅 시 중립 평균 샘플 수
+
+// 컨트롤러별 고정 보정값: USB로 출력된 "CAL PIN" 줄을 그대로 붙여넣어 사용
+// 예) #define JOY_CAL_PINNED {{10,2051,3000},{10,2040,3000},{10,2060,3000},{10,2048,3000}}
+
+// 축별 보정 상수 (Q16 역수 스케일)
+typedef struct {
+    uint32_t raw_min;
+    uint32_t raw_neutral;
+    uint32_t raw_max;
+    uint32_t scale_lo;  // (JOY_OUT_MID << 16) / (neutral - min)
+    uint32_t scale_hi;  // ((JOY_OUT_MAX - JOY_OUT_MID) << 16) / (max - neutral)
+} joy_axis_cal_t;
+
+void joy_calib_init(joy_axis_cal_t *cal, const uint32_t *raw_min, const uint32_t *raw_max);
+void joy_calib_capture_neutral(joy_axis_cal_t *cal, uint32_t adc_base);
+void joy_calib_learn_range(joy_axis_cal_t *cal, uint32_t adc_base, uint32_t btn_base, uint32_t btn_mask);
+void joy_calib_finalize(joy_axis_cal_t *cal);
+void joy_calib_report(const joy_axis_cal_t *cal);
+
+// 루프용 보정: 나눗셈 없이 곱셈 + 시프트만 사용
+// 중립은 정확히 JOY_OUT_MID, 양 끝은 0 / JOY_OUT_MAX로 매핑
+static inline uint32_t joy_calib_apply(const joy_axis_cal_t *c, uint32_t raw)
+{
+    if (raw <= c->raw_min) return 0;
+    if (raw >= c->raw_max) return JOY_OUT_MAX;
+
+    if (raw < c->raw_neutral) {
+        // (neutral - raw) <= (neutral - min) 이므로 곱은 JOY_OUT_MID << 16 근처에서 끝남
+        uint32_t d = ((c->raw_neutral - raw) * c->scale_lo) >> 16;
+        return (d >= JOY_OUT_MID) ? 0 : JOY_OUT_MID - d;
+    }
+
+    uint32_t u = JOY_OUT_MID + (((raw - c->raw_neutral) * c->scale_hi) >> 16);
+    return (u > JOY_OUT_MAX) ? JOY_OUT_MAX : u;
+}
+
+#endif
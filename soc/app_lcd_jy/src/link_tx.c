@@ -0,0 +1,47 @@
+#include "link_tx.h"
+#include "sched.h"
+#include "xiltimer.h"
+
+static uint8_t tx_seq;
+
+// CRC-16/CCITT-FALSE (myip_frame_rx 의 frame_decoder 와 같음)
+static uint16_t crc16(const uint8_t *p, int len)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (len--) {
+        crc ^= (uint16_t)*p++ << 8;
+        for (int k = 0; k < 8; k++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+uint32_t link_tx_stamp(void)
+{
+    return (uint32_t)(now_cycles() / (COUNTS_PER_SECOND / 1000));
+}
+
+int link_tx_build(uint8_t *out, int mode, int btn, int flags, const uint16_t *axes)
+{
+    uint8_t *p = out + 2;
+
+    out[0] = 0xA5;
+    out[1] = 0x5A;
+    p[0] = tx_seq++;
+    p[1] = mode;
+    p[2] = btn;
+    p[3] = flags;
+    for (int i = 0; i < 4; i++) {
+        uint16_t v = axes ? axes[i] : 0;
+        p[4 + i * 2] = v & 0xFF;
+        p[5 + i * 2] = v >> 8;
+    }
+    uint32_t stamp = link_tx_stamp();
+    for (int i = 0; i < 4; i++) p[12 + i] = stamp >> (i * 8);
+
+    uint16_t crc = crc16(p, 16);
+    out[18] = crc >> 8;
+    out[19] = crc & 0xFF;
+    return LINK_FRAME_LEN;
+}
@@ -0,0 +1,28 @@
+#ifndef LINK_TX_H
+#define LINK_TX_H
+
+#include <stdint.h>
+
+// 조종기 -> 굴삭기 이진 프레임 (수신부 myip_frame_rx 가 동기/CRC를 하드웨어로 확인)
+//   A5 5A | 송신 번호, 모드, 버튼, 플래그, X1, Y1, X2, Y2 (u16 리틀 엔디언), 송신 시각 (u32 ms) | CRC16 상위, 하위
+// 송신 시각은 큐에 넣는 순간 (스틱을 읽은 시점): 수신부가 이것으로 고른 간격에 재생
+// 수신부 비트스트림에 myip_frame_rx 를 넣었으면 1 (0 = 기존 텍스트 줄, 수신부는 둘 다 받음)
+#ifndef LINK_TX_FRAMES
+#define LINK_TX_FRAMES      0
+#endif
+
+#define LINK_FRAME_LEN      20
+#define LINK_FLAG_NEUTRAL   (1u << 0)   // 중립 (모터 정지)
+#define LINK_FLAG_AXES      (1u << 1)   // X1~Y2 유효
+
+// 대역 외 제어 바이트 (수신부 link_rx.h 와 같음): 큐에 쌓인 줄/프레임을 앞질러 한 바이트로 전송
+// 텍스트 줄은 중간에 끼어도 되고, 이진 프레임은 프레임 사이에만 넣음
+#define LINK_OOB_ESTOP      0x1C
+#define LINK_OOB_WORK       0x1D
+#define LINK_OOB_DRIVE      0x1E
+
+// 프레임을 out에 만들고 길이 반환. axes = {X1, Y1, X2, Y2}, NULL이면 0
+int link_tx_build(uint8_t *out, int mode, int btn, int flags, const uint16_t *axes);
+uint32_t link_tx_stamp(void);           // 송신 시각 (ms, 텍스트 줄 T= 에도 씀)
+
+#endif
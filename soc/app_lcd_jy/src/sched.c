@@ -0,0 +1,108 @@
+#include "sched.h"
+#include "xiltimer.h"
+#include "xil_types.h"
+#include "xpseudo_asm.h"
+#include "xil_printf.h"
+
+#define CYC_PER_US (COUNTS_PER_SECOND / 1000000)
+
+static sched_task_t *task_tab;
+static int task_cnt;
+static uint64_t idle_cyc;      // 실행할 태스크가 없던 시간
+static uint64_t report_start;
+
+// time CSR 을 직접 읽음 (BSP 기본 타이머가 MB_RISCV 라 XTime_GetTime 이 없음)
+// 하위를 읽는 사이 상위가 넘어가면 다시 읽음
+uint64_t now_cycles(void)
+{
+    uint32_t hi, lo;
+
+    do {
+        hi = csrr(XREG_TIMEH);
+        lo = rdtime();
+    } while (hi != csrr(XREG_TIMEH));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static uint32_t cyc_to_us(uint64_t cyc)
+{
+    return (uint32_t)(cyc / CYC_PER_US);
+}
+
+void sched_init(sched_task_t *tasks, int count)
+{
+    uint64_t now = now_cycles();
+
+    task_tab = tasks;
+    task_cnt = count;
+    idle_cyc = 0;
+    report_start = now;
+
+    for (int i = 0; i < count; i++) {
+        sched_task_t *t = &tasks[i];
+        t->period_cyc = (uint64_t)t->period_us * CYC_PER_US;
+        t->deadline_cyc = (uint64_t)(t->deadline_us ? t->deadline_us : t->period_us) * CYC_PER_US;
+        t->next_release = now;
+        t->runs = 0;
+        t->overruns = 0;
+        t->skipped = 0;
+        t->last_us = 0;
+        t->max_us = 0;
+    }
+}
+
+// 릴리즈된 태스크를 표 순서대로 한 번씩 실행, 실행한 개수 반환
+int sched_run_pending(void)
+{
+    uint64_t pass_start = now_cycles();
+    int ran = 0;
+
+    for (int i = 0; i < task_cnt; i++) {
+        sched_task_t *t = &task_tab[i];
+        uint64_t start = now_cycles();
+
+        if (start < t->next_release) continue;
+
+        uint64_t release = t->next_release;
+        t->fn();
+        uint64_t end = now_cycles();
+
+        uint64_t run = end - start;
+        t->last_us = cyc_to_us(run);
+        if (t->last_us > t->max_us) t->max_us = t->last_us;
+        if (end - release > t->deadline_cyc) t->overruns++;
+        t->runs++;
+
+        // 다음 릴리즈: 주기 단위로 진행, 너무 밀렸으면 몰아서 실행하지 않고 건너뜀
+        t->next_release = release + t->period_cyc;
+        if (t->next_release <= end) {
+            uint64_t behind = (end - t->next_release) / t->period_cyc + 1;
+            t->skipped += (uint32_t)behind;
+            t->next_release += behind * t->period_cyc;
+        }
+        ran++;
+    }
+
+    if (!ran) idle_cyc += now_cycles() - pass_start;
+    return ran;
+}
+
+// 태스크별 통계 출력 후 구간 통계 초기화
+void sched_report(void)
+{
+    uint64_t now = now_cycles();
+    uint64_t window = now - report_start;
+    uint32_t idle_pct = window ? (uint32_t)(idle_cyc * 100 / window) : 0;
+
+    xil_printf("SCHED idle=%u%%\r\n", idle_pct);
+    for (int i = 0; i < task_cnt; i++) {
+        sched_task_t *t = &task_tab[i];
+        xil_printf("SCHED %s runs=%u last=%uus max=%uus overrun=%u skip=%u\r\n",
+            t->name, t->runs, t->last_us, t->max_us, t->overruns, t->skipped);
+        t->runs = 0;
+        t->max_us = 0;
+    }
+
+    idle_cyc = 0;
+    report_start = now;
+}
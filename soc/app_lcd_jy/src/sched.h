@@ -0,0 +1,36 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+
+// 협력형 run-to-completion 스케줄러
+// 시간 기준은 CPU 사이클 카운터(time CSR), 태스크는 표 순서가 곧 우선순위
+typedef void (*sched_fn_t)(void);
+
+typedef struct {
+    const char *name;
+    sched_fn_t fn;
+    uint32_t period_us;     // 실행 주기
+    uint32_t deadline_us;   // 릴리즈 후 이 시간 안에 끝나야 함 (0이면 주기와 같음)
+
+    // 이하 sched_init()이 채움
+    uint64_t period_cyc;
+    uint64_t deadline_cyc;
+    uint64_t next_release;
+    uint32_t runs;
+    uint32_t overruns;      // 데드라인을 넘긴 횟수
+    uint32_t skipped;       // 밀려서 건너뛴 주기 수
+    uint32_t last_us;       // 마지막 실행 시간
+    uint32_t max_us;        // 최대 실행 시간
+} sched_task_t;
+
+// 태스크 표 한 줄: 설정 필드만 채우고 나머지는 0 (sched_init()이 채움)
+#define SCHED_TASK(n, f, period, deadline) \
+    { .name = (n), .fn = (f), .period_us = (period), .deadline_us = (deadline) }
+
+uint64_t now_cycles(void);     // 부팅 후 사이클 수 (COUNTS_PER_SECOND 단위)
+void sched_init(sched_task_t *tasks, int count);
+int sched_run_pending(void);
+void sched_report(void);
+
+#endif